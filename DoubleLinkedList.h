@@ -1,18 +1,111 @@
 #pragma once
 
 #include "LinkedListsException.h"
+#include "PositionalIndex.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Hint to load the memory at address into the cache before it is read
+ * It expands to nothing for compilers without __builtin_prefetch
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LINKED_LISTS_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define LINKED_LISTS_PREFETCH(address) ((void) 0)
+#endif
 
 namespace LinkedLists {
 
+    /**
+     * @brief Tells whether the allocator memory is reclaimed in bulk by its owner,
+     *        so that single deallocations may be skipped
+     *        Allocators declare it by the nested type is_bulk_released = std::true_type
+     *
+     * @tparam Allocator
+     */
+    template<class Allocator, class = void>
+    struct AllocatorReleasesInBulk : std::false_type {
+    };
+
+    template<class Allocator>
+    struct AllocatorReleasesInBulk<Allocator, std::void_t<typename Allocator::is_bulk_released>>
+            : Allocator::is_bulk_released {
+    };
+
+    /**
+     * @brief Tells whether the allocator can prepare contiguous memory for n objects in advance
+     *        by the member function reserve(n), so that the next n single allocations are adjacent
+     *
+     * @tparam Allocator
+     */
+    template<class Allocator, class = void>
+    struct AllocatorReservesInAdvance : std::false_type {
+    };
+
+    template<class Allocator>
+    struct AllocatorReservesInAdvance<Allocator,
+            std::void_t<decltype(std::declval<Allocator &>().reserve(std::declval<size_t>()))>> : std::true_type {
+    };
+
+    /**
+     * @brief Tells whether copies of the allocator may allocate and deallocate concurrently
+     *        from several threads. It holds for std::allocator, other allocators declare it
+     *        by the nested type is_thread_safe = std::true_type
+     *
+     * @tparam Allocator
+     */
+    template<class Allocator, class = void>
+    struct AllocatorIsThreadSafe : std::false_type {
+    };
+
+    template<class U>
+    struct AllocatorIsThreadSafe<std::allocator<U>, void> : std::true_type {
+    };
+
+    template<class Allocator>
+    struct AllocatorIsThreadSafe<Allocator, std::void_t<typename Allocator::is_thread_safe>>
+            : Allocator::is_thread_safe {
+    };
+
+    /**
+     * @brief Node layout of DoubleLinkedList: the element is stored inside the node next to the links
+     */
+    struct InlineNodeLayout {
+    };
+
+    /**
+     * @brief Node layout of DoubleLinkedList: the node holds the links and a pointer to the element,
+     *        which is allocated out of line. Walks which only follow the links touch
+     *        small nodes instead of cache lines filled with large elements
+     */
+    struct SplitNodeLayout {
+    };
+
+    namespace parallel {
+
+        // Builds lists from segments copied on a thread pool, defined in ParallelAlgorithms.h
+        class ListConstruction;
+
+    }
+
     /**
      * @class DoubleLinkedList
      *
      * @brief Implements a template doubly linked list
-     *        It uses a single-pointer implementation that points
+     *        It uses a sentinel node stored inside the list object that points
      *        to both the beginning of the list and the end (ring view)
+     *        The sentinel holds no data, so an empty list allocates nothing
      *
      * @author Andrey Valitov
      *
@@ -20,23 +113,865 @@ namespace LinkedLists {
      *                  Fix bug with erase the second element instead the first in method pop_front
      *
      * @tparam T
+     * @tparam Allocator - allocator of T, it is rebound to the list node type
+     *                     and used for every element node
+     * @tparam NodeLayout - InlineNodeLayout or SplitNodeLayout
      */
-    template<class T>
+    template<class T, class Allocator = std::allocator<T>, class NodeLayout = InlineNodeLayout>
     class DoubleLinkedList {
     private:
 
-        struct Node {
-            T data;
-            Node *prev;
-            Node *next;
+        static_assert(std::is_same_v<NodeLayout, InlineNodeLayout> || std::is_same_v<NodeLayout, SplitNodeLayout>,
+                      "NodeLayout must be InlineNodeLayout or SplitNodeLayout");
+
+        static constexpr bool splitNodeLayout_ = std::is_same_v<NodeLayout, SplitNodeLayout>;
+
+        // Links of a node, the sentinel consists of them only
+        struct NodeBase {
+            NodeBase *prev;
+            NodeBase *next;
+        };
+
+        struct InlineNode : NodeBase {
+            T data;
+        };
+
+        struct SplitNode : NodeBase {
+            T *data;
+        };
+
+        using Node = std::conditional_t<splitNodeLayout_, SplitNode, InlineNode>;
+
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+        // Allocator of out of line elements in SplitNodeLayout
+        using DataAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+        using DataAllocatorTraits = std::allocator_traits<DataAllocator>;
+
+        // Nodes may be dropped without visiting them: there is nothing to destroy or deallocate
+        static constexpr bool dropNodesInBulk_ =
+                std::is_trivially_destructible_v<T> && AllocatorReleasesInBulk<NodeAllocator>::value;
+
+        NodeBase sentinel_;
+
+        size_t doubleLinkedListSize_;
+
+        NodeAllocator nodeAllocator_;
+
+        /*
+         * Erased nodes which are kept for reuse by the next insertions
+         * They are linked through the next pointer and hold no data
+         */
+        NodeBase *cachedNodes_ = nullptr;
+
+        size_t cachedNodesCount_ = 0;
+
+        // Zero limit means that erased nodes are returned to the allocator immediately
+        size_t nodeCacheLimit_ = 0;
+
+        /*
+         * Node from which the next compact() call continues, nullptr if no pass is in progress
+         * It is moved forward when its node is erased and dropped when nodes leave the list in bulk
+         */
+        NodeBase *compactCursor_ = nullptr;
+
+        /*
+         * Number of nodes ahead of the visited one which whole-list walks prefetch
+         * The lookahead itself is a chain of dependent loads, so it is disabled by default
+         */
+        size_t prefetchDistance_ = 0;
+
+        /*
+         * Order-statistic index of the nodes, it is kept only when the positional index is enabled
+         * Single insertions and erasures update it, the other structural changes only mark it stale,
+         * and the next non-const positional call rebuilds it in O(n)
+         */
+        PositionalIndex<const NodeBase *> positionalIndex_;
+
+        bool positionalIndexEnabled_ = false;
+
+        bool positionalIndexStale_ = false;
+
+        /*
+         * Node resolved by the last non-const positional call and its position, nullptr if unknown
+         * Positional walks start from it when it is nearer than the ends, so scans by position
+         * take O(1) per step. Insertions before the end and erasures of other nodes drop it
+         */
+        const NodeBase *fingerNode_ = nullptr;
+
+        size_t fingerPosition_ = 0;
+
+        // Walks up to this length are preferred to the positional index lookup
+        static constexpr size_t FINGER_WALK_LIMIT = 16;
+
+        /**
+         * @brief Marks the positional index outdated and drops the finger after the nodes were relinked in bulk
+         */
+        void invalidatePositionalIndex() noexcept {
+            positionalIndexStale_ = true;
+            fingerNode_ = nullptr;
+        };
+
+        /**
+         * @return true, if the positional index is enabled and matches the list
+         */
+        bool positionalIndexReady() const noexcept {
+            return positionalIndexEnabled_ && !positionalIndexStale_;
+        };
+
+        /**
+         * @brief Rebuilds the stale positional index from the current order of the nodes
+         */
+        void refreshPositionalIndex() {
+            if (positionalIndexEnabled_ && positionalIndexStale_) {
+                const NodeBase *current = &sentinel_;
+                positionalIndex_.build(doubleLinkedListSize_, [&current]() {
+                    current = current->next;
+                    return current;
+                });
+                positionalIndexStale_ = false;
+            }
+        };
+
+        /**
+         * @brief Finds the node at the position by walking from the nearest of the finger, the begin
+         *        and the end of the list. The ready index is used instead of a walk longer than FINGER_WALK_LIMIT
+         *
+         * @param position - position not greater than size(), size() gives the sentinel
+         * @return node at the position
+         */
+        const NodeBase *nodeAt(size_t position) const {
+            if (position == doubleLinkedListSize_) {
+                return &sentinel_;
+            }
+            const NodeBase *current = sentinel_.next;
+            size_t currentPosition = 0;
+            size_t distance = position;
+            if (doubleLinkedListSize_ - 1 - position < distance) {
+                current = sentinel_.prev;
+                currentPosition = doubleLinkedListSize_ - 1;
+                distance = doubleLinkedListSize_ - 1 - position;
+            }
+            if (fingerNode_ != nullptr) {
+                size_t fingerDistance = position > fingerPosition_ ? position - fingerPosition_
+                                                                   : fingerPosition_ - position;
+                if (fingerDistance < distance) {
+                    current = fingerNode_;
+                    currentPosition = fingerPosition_;
+                    distance = fingerDistance;
+                }
+            }
+            if (distance > FINGER_WALK_LIMIT && positionalIndexReady()) {
+                return positionalIndex_.at(position);
+            }
+            for (; currentPosition < position; ++currentPosition) {
+                current = current->next;
+            }
+            for (; currentPosition > position; --currentPosition) {
+                current = current->prev;
+            }
+            return current;
+        };
+
+        /**
+         * @brief Remembers the node at the position as the start of the next positional walks
+         *
+         * @param node - node of the list or the sentinel, which is not remembered
+         * @param position - position of the node
+         */
+        void setFinger(const NodeBase *node, size_t position) noexcept {
+            if (node != &sentinel_) {
+                fingerNode_ = node;
+                fingerPosition_ = position;
+            }
+        };
+
+        /**
+         * @brief Finds the position of the node by the index if it is ready, otherwise counts it from the begin
+         *
+         * @param node - node of the list or the sentinel
+         * @return position of the node, size() for the sentinel
+         */
+        size_t positionOf(const NodeBase *node) const {
+            if (node == &sentinel_) {
+                return doubleLinkedListSize_;
+            }
+            if (positionalIndexReady()) {
+                return positionalIndex_.index_of(node);
+            }
+            size_t position = 0;
+            for (const NodeBase *current = sentinel_.next; current != node; current = current->next) {
+                ++position;
+            }
+            return position;
+        };
+
+        /**
+         * @brief Takes a node from the cache of erased nodes or allocates a new one
+         *
+         * @return pointer to the node memory without data
+         */
+        Node *acquireNode() {
+            if (cachedNodes_ != nullptr) {
+                NodeBase *node = cachedNodes_;
+                cachedNodes_ = node->next;
+                --cachedNodesCount_;
+                return static_cast<Node *>(node);
+            }
+            return NodeAllocatorTraits::allocate(nodeAllocator_, 1);
+        };
+
+        /**
+         * @brief Puts the node without data to the cache or returns it to the allocator, if the cache is full
+         *
+         * @param node - node to release
+         */
+        void releaseNode(Node *node) {
+            if (cachedNodesCount_ < nodeCacheLimit_) {
+                node->next = cachedNodes_;
+                cachedNodes_ = node;
+                ++cachedNodesCount_;
+            } else {
+                NodeAllocatorTraits::deallocate(nodeAllocator_, node, 1);
+            }
+        };
+
+        /**
+         * @brief Allocates a node through the list allocator and constructs its data in place
+         *
+         * @param args - arguments forwarded to the constructor of T
+         * @return pointer to the new node, its links are not initialized
+         */
+        template<class... Args>
+        Node *createNode(Args &&... args) {
+            Node *newNode = acquireNode();
+            try {
+                constructData(nodeAllocator_, newNode, std::forward<Args>(args)...);
+            } catch (...) {
+                releaseNode(newNode);
+                throw;
+            }
+            return newNode;
+        };
+
+        /**
+         * @brief Constructs the data of the node memory through allocator
+         *        If the construction throws, nothing is left allocated except the node itself
+         *
+         * @param allocator - list allocator or its copy
+         * @param node - node memory without data
+         * @param args - arguments forwarded to the constructor of T
+         */
+        template<class... Args>
+        static void constructData(NodeAllocator &allocator, Node *node, Args &&... args) {
+            if constexpr (splitNodeLayout_) {
+                DataAllocator dataAllocator(allocator);
+                T *data = DataAllocatorTraits::allocate(dataAllocator, 1);
+                try {
+                    DataAllocatorTraits::construct(dataAllocator, data, std::forward<Args>(args)...);
+                } catch (...) {
+                    DataAllocatorTraits::deallocate(dataAllocator, data, 1);
+                    throw;
+                }
+                node->data = data;
+            } else {
+                NodeAllocatorTraits::construct(allocator, std::addressof(node->data), std::forward<Args>(args)...);
+            }
+        };
+
+        /**
+         * @brief Allocates a node through the copy of the list allocator, bypassing the node cache,
+         *        so that several threads may create nodes of one list at once
+         *
+         * @param allocator - copy of the list allocator owned by the calling thread
+         * @param args - arguments forwarded to the constructor of T
+         * @return pointer to the new node, its links are not initialized
+         */
+        template<class... Args>
+        static Node *createUncachedNode(NodeAllocator &allocator, Args &&... args) {
+            Node *newNode = NodeAllocatorTraits::allocate(allocator, 1);
+            try {
+                constructData(allocator, newNode, std::forward<Args>(args)...);
+            } catch (...) {
+                NodeAllocatorTraits::deallocate(allocator, newNode, 1);
+                throw;
+            }
+            return newNode;
+        };
+
+        /**
+         * @brief Destroys node data and releases the node memory
+         *
+         * @param node - node to destroy, it must be already unlinked
+         */
+        void destroyNode(Node *node) {
+            if constexpr (splitNodeLayout_) {
+                DataAllocator dataAllocator(nodeAllocator_);
+                DataAllocatorTraits::destroy(dataAllocator, node->data);
+                DataAllocatorTraits::deallocate(dataAllocator, node->data, 1);
+            } else {
+                NodeAllocatorTraits::destroy(nodeAllocator_, std::addressof(node->data));
+            }
+            releaseNode(node);
+        };
+
+        /**
+         * @return element node behind the link pointer, it must not be the sentinel
+         */
+        static Node *asNode(NodeBase *link) {
+            return static_cast<Node *>(link);
+        };
+
+        static const Node *asNode(const NodeBase *link) {
+            return static_cast<const Node *>(link);
+        };
+
+        /**
+         * @return element of the node behind the link pointer, it must not be the sentinel
+         */
+        static T &valueOf(NodeBase *link) {
+            if constexpr (splitNodeLayout_) {
+                return *asNode(link)->data;
+            } else {
+                return asNode(link)->data;
+            }
+        };
+
+        static const T &valueOf(const NodeBase *link) {
+            if constexpr (splitNodeLayout_) {
+                return *asNode(link)->data;
+            } else {
+                return asNode(link)->data;
+            }
+        };
+
+        /**
+         * @brief Moves the lookahead pointer one node forward and prefetches the node it reaches
+         *        With SplitNodeLayout the element of the node it leaves is prefetched as well
+         *
+         * @param ahead - lookahead pointer, it stops at end
+         * @param end - sentinel of the walked list
+         */
+        template<class Link>
+        static void prefetchAhead(Link *&ahead, const NodeBase *end) {
+            if (ahead == end) {
+                return;
+            }
+            if constexpr (splitNodeLayout_) {
+                LINKED_LISTS_PREFETCH(asNode(ahead)->data);
+            }
+            ahead = ahead->next;
+            LINKED_LISTS_PREFETCH(ahead);
+        };
+
+        /**
+         * @brief Visits all nodes of the list, while the node distance positions ahead is prefetched
+         *        The next node is read before the visit, so visit may destroy the node it gets
+         *
+         * @param sentinel - sentinel of the list to walk
+         * @param distance - number of nodes to prefetch ahead of the visited one
+         * @param visit - function called for every node
+         */
+        template<class Link, class Visitor>
+        static void walkPrefetched(Link *sentinel, size_t distance, Visitor &&visit) {
+            Link *ahead = sentinel->next;
+            for (size_t i = 0; i < distance; i++) {
+                prefetchAhead(ahead, sentinel);
+            }
+            Link *current = sentinel->next;
+            while (current != sentinel) {
+                Link *next = current->next;
+                prefetchAhead(ahead, sentinel);
+                visit(current);
+                current = next;
+            }
+        };
+
+        /**
+         * @brief Unlinks the run of nodes from first to last (not include) and appends it
+         *        to the detached chain of removed nodes, which are destroyed after the scan
+         *
+         * @param first - first node of the run
+         * @param last - node after the run, it stays in the list
+         * @param count - number of nodes in the run
+         * @param removedHead - first node of the removed chain, nullptr for the empty chain
+         * @param removedTail - last node of the removed chain
+         */
+        void detachRun(NodeBase *first, NodeBase *last, size_t count,
+                       NodeBase *&removedHead, NodeBase *&removedTail) noexcept {
+            if (compactCursor_ != nullptr) {
+                for (NodeBase *node = first; node != last; node = node->next) {
+                    if (node == compactCursor_) {
+                        compactCursor_ = last == &sentinel_ ? nullptr : last;
+                        break;
+                    }
+                }
+            }
+            NodeBase *runTail = last->prev;
+            unlinkRange(first, last);
+            doubleLinkedListSize_ -= count;
+            invalidatePositionalIndex();
+            if (removedTail == nullptr) {
+                removedHead = first;
+            } else {
+                removedTail->next = first;
+                first->prev = removedTail;
+            }
+            removedTail = runTail;
+        };
+
+        /**
+         * @brief Removes all nodes for which isRemoved returns true in one prefetching walk
+         *        Adjacent removed nodes are unlinked as one run, and all of them are destroyed
+         *        after the walk, so isRemoved may look at the nodes which are already removed
+         *
+         * @param isRemoved - function called once for every node in the list order
+         * @return number of removed elements
+         */
+        template<class Marker>
+        size_t removeMarkedNodes(Marker &&isRemoved) {
+            NodeBase *removedHead = nullptr;
+            NodeBase *removedTail = nullptr;
+            NodeBase *runHead = nullptr;
+            size_t runLength = 0;
+            size_t counter = 0;
+            try {
+                walkPrefetched(&sentinel_, prefetchDistance_, [&](NodeBase *node) {
+                    if (isRemoved(node)) {
+                        if (runHead == nullptr) {
+                            runHead = node;
+                        }
+                        ++runLength;
+                    } else if (runHead != nullptr) {
+                        detachRun(runHead, node, runLength, removedHead, removedTail);
+                        counter += runLength;
+                        runHead = nullptr;
+                        runLength = 0;
+                    }
+                });
+                if (runHead != nullptr) {
+                    detachRun(runHead, &sentinel_, runLength, removedHead, removedTail);
+                    counter += runLength;
+                }
+            } catch (...) {
+                destroyChain(removedHead, removedTail);
+                throw;
+            }
+            destroyChain(removedHead, removedTail);
+            return counter;
+        };
+
+        /**
+         * @brief Makes the empty ring of the sentinel
+         */
+        void resetSentinel() noexcept {
+            sentinel_.prev = &sentinel_;
+            sentinel_.next = &sentinel_;
+            doubleLinkedListSize_ = 0;
+            compactCursor_ = nullptr;
+            invalidatePositionalIndex();
+        };
+
+        /**
+         * @brief Makes sentinel the ring holder of the nodes from head to tail
+         *
+         * @param sentinel - sentinel to link
+         * @param head - first node or nullptr for the empty ring
+         * @param tail - last node
+         */
+        static void linkSentinel(NodeBase &sentinel, NodeBase *head, NodeBase *tail) noexcept {
+            if (head == nullptr) {
+                sentinel.prev = &sentinel;
+                sentinel.next = &sentinel;
+            } else {
+                sentinel.next = head;
+                sentinel.prev = tail;
+                head->prev = &sentinel;
+                tail->next = &sentinel;
+            }
+        };
+
+        /**
+         * @brief Takes all nodes of other without allocations, other becomes empty
+         *        The current list must be empty
+         *
+         * @param other - list to take the nodes from
+         */
+        void takeNodesFrom(DoubleLinkedList &other) noexcept {
+            if (!other.empty()) {
+                linkSentinel(sentinel_, other.sentinel_.next, other.sentinel_.prev);
+                doubleLinkedListSize_ = other.doubleLinkedListSize_;
+                invalidatePositionalIndex();
+                other.resetSentinel();
+            }
+        };
+
+        /**
+         * @brief Destroys the detached chain of nodes linked through next
+         *
+         * @param head - first node of the chain
+         * @param tail - last node of the chain
+         */
+        void destroyChain(NodeBase *head, NodeBase *tail) {
+            while (head != nullptr) {
+                NodeBase *next = head == tail ? nullptr : head->next;
+                destroyNode(asNode(head));
+                head = next;
+            }
+        };
+
+        /**
+         * @brief Links the detached chain of nodes before the node pointed to by before
+         *
+         * @param before - node before which the chain is linked
+         * @param head - first node of the chain
+         * @param tail - last node of the chain
+         * @param count - number of nodes in the chain
+         */
+        void linkChain(NodeBase *before, NodeBase *head, NodeBase *tail, size_t count) noexcept {
+            NodeBase *savePrevBefore = before->prev;
+            savePrevBefore->next = head;
+            head->prev = savePrevBefore;
+            tail->next = before;
+            before->prev = tail;
+            doubleLinkedListSize_ += count;
+            invalidatePositionalIndex();
+        };
+
+        /**
+         * @brief Unlinks the nodes from first to last (not include) from their ring
+         *        The nodes keep their links to each other, the size is not changed
+         *
+         * @param first - first node to unlink
+         * @param last - node after the last one to unlink
+         */
+        static void unlinkRange(NodeBase *first, NodeBase *last) noexcept {
+            NodeBase *savePrevFirst = first->prev;
+            savePrevFirst->next = last;
+            last->prev = savePrevFirst;
+        };
+
+        /**
+         * @brief Checks that the nodes of other may be owned by the current list
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param other - list whose nodes are going to be relinked to the current one
+         */
+        void checkSpliceAllocator(const DoubleLinkedList &other) const {
+            if constexpr (!NodeAllocatorTraits::is_always_equal::value) {
+                if (nodeAllocator_ != other.nodeAllocator_) {
+                    throw LinkedLists::LinkedListsException("Can't splice lists with different allocators");
+                }
+            }
+        };
+
+        /**
+         * @brief Appends the node to the end of the detached chain
+         *
+         * @param head - first node of the chain, nullptr for the empty chain
+         * @param tail - last node of the chain
+         * @param node - node to append
+         */
+        static void appendToChain(NodeBase *&head, NodeBase *&tail, NodeBase *node) noexcept {
+            if (tail == nullptr) {
+                head = node;
+            } else {
+                tail->next = node;
+                node->prev = tail;
+            }
+            tail = node;
+        };
+
+        /**
+         * @brief Asks the allocator, if it supports reserve(n), to prepare contiguous memory
+         *        for count new nodes, which are not covered by the node cache
+         *
+         * @param count - number of nodes which are going to be created
+         */
+        void prepareNodes(size_t count) {
+            if constexpr (AllocatorReservesInAdvance<NodeAllocator>::value) {
+                if (count > cachedNodesCount_) {
+                    nodeAllocator_.reserve(count - cachedNodesCount_);
+                }
+            }
+        };
+
+        /**
+         * @brief Copies all elements of other to the end of the current list
+         *        The nodes are created one after another into a detached chain, which is
+         *        linked to the list at once. Allocators which support reserve(n) are asked
+         *        to prepare contiguous memory for all new nodes first
+         *        The number of elements is fixed before copying, so other may be the current list
+         *
+         * @param other - list to copy from
+         */
+        void appendCopyOf(const DoubleLinkedList &other) {
+            size_t count = other.size();
+            if (count == 0) {
+                return;
+            }
+            prepareNodes(count);
+
+            NodeBase *head = nullptr;
+            NodeBase *tail = nullptr;
+            const NodeBase *current = other.sentinel_.next;
+            try {
+                for (size_t i = 0; i < count; i++) {
+                    appendToChain(head, tail, createNode(valueOf(current)));
+                    current = current->next;
+                }
+            } catch (...) {
+                destroyChain(head, tail);
+                throw;
+            }
+            linkChain(&sentinel_, head, tail, count);
+        };
+
+        /**
+         * @brief Copies the elements from first to last (not include) to the end of the current list
+         *        through a detached chain of nodes
+         *
+         * @param first - iterator to the first element to copy
+         * @param last - iterator to the element after the last one to copy
+         */
+        template<class InputIterator>
+        void appendRange(InputIterator first, InputIterator last) {
+            NodeBase *head = nullptr;
+            NodeBase *tail = nullptr;
+            size_t count = 0;
+            try {
+                for (; first != last; ++first) {
+                    appendToChain(head, tail, createNode(*first));
+                    ++count;
+                }
+            } catch (...) {
+                destroyChain(head, tail);
+                throw;
+            }
+            if (count > 0) {
+                linkChain(&sentinel_, head, tail, count);
+            }
+        };
+
+        /**
+         * @brief Copies the segments of a source into detached chains, then links the chains
+         *        to the end of the list in the segment order. If a copy throws, all new nodes are destroyed
+         *        The segments are handed to runSegments, which may copy them concurrently:
+         *        every segment allocates its nodes through its own copy of the allocator,
+         *        so the allocator has to be thread safe then (see AllocatorIsThreadSafe)
+         *
+         * @param boundaries - segments + 1 iterators of the source,
+         *                     the segment i is from the i-th to the (i + 1)-th one
+         * @param count - number of elements in all segments
+         * @param runSegments - function of the number of segments and of the body, which has to call
+         *                      body(segment) once for every segment and rethrow an exception of a body
+         */
+        template<class Iterator, class RunSegments>
+        void appendSegments(const std::vector<Iterator> &boundaries, size_t count, RunSegments &&runSegments) {
+            size_t segments = boundaries.size() - 1;
+            std::vector<NodeBase *> heads(segments, nullptr);
+            std::vector<NodeBase *> tails(segments, nullptr);
+            try {
+                runSegments(segments, [&](size_t segment) {
+                    NodeAllocator allocator(nodeAllocator_);
+                    for (Iterator current = boundaries[segment]; current != boundaries[segment + 1]; ++current) {
+                        appendToChain(heads[segment], tails[segment], createUncachedNode(allocator, *current));
+                    }
+                });
+            } catch (...) {
+                for (size_t segment = 0; segment < segments; segment++) {
+                    destroyChain(heads[segment], tails[segment]);
+                }
+                throw;
+            }
+
+            NodeBase *head = nullptr;
+            NodeBase *tail = nullptr;
+            for (size_t segment = 0; segment < segments; segment++) {
+                if (heads[segment] == nullptr) {
+                    continue;
+                }
+                if (tail == nullptr) {
+                    head = heads[segment];
+                } else {
+                    tail->next = heads[segment];
+                    heads[segment]->prev = tail;
+                }
+                tail = tails[segment];
+            }
+            if (head != nullptr) {
+                linkChain(&sentinel_, head, tail, count);
+            }
+        };
 
+        /**
+         * @brief Moves the elements of up to count nodes starting from first into freshly allocated nodes
+         *        The new nodes are taken from the allocator one after another, bypassing the node cache,
+         *        the old ones are returned to the allocator only after the whole batch, so that their memory
+         *        is not handed out again for the next new node. They bypass the cache as well,
+         *        otherwise the next insertions would take the scattered nodes compact() has just left
+         *
+         * @param first - first node to relocate
+         * @param count - maximum number of nodes to relocate
+         * @return node after the last relocated one
+         */
+        NodeBase *relocateNodes(NodeBase *first, size_t count) {
+            if constexpr (AllocatorReservesInAdvance<NodeAllocator>::value) {
+                // The default budget of compact() is unlimited
+                nodeAllocator_.reserve(std::min(count, doubleLinkedListSize_));
+            }
+            NodeBase *retiredHead = nullptr;
+            NodeBase *retiredTail = nullptr;
+            NodeBase *current = first;
+            try {
+                for (; count > 0 && current != &sentinel_; count--) {
+                    Node *oldNode = asNode(current);
+                    Node *newNode = NodeAllocatorTraits::allocate(nodeAllocator_, 1);
+                    try {
+                        NodeAllocatorTraits::construct(nodeAllocator_, std::addressof(newNode->data),
+                                                       std::move_if_noexcept(oldNode->data));
+                    } catch (...) {
+                        NodeAllocatorTraits::deallocate(nodeAllocator_, newNode, 1);
+                        throw;
+                    }
+                    newNode->prev = oldNode->prev;
+                    newNode->next = oldNode->next;
+                    oldNode->prev->next = newNode;
+                    oldNode->next->prev = newNode;
+                    current = oldNode->next;
+
+                    NodeAllocatorTraits::destroy(nodeAllocator_, std::addressof(oldNode->data));
+                    appendToChain(retiredHead, retiredTail, oldNode);
+                }
+            } catch (...) {
+                deallocateChain(retiredHead, retiredTail);
+                throw;
+            }
+            deallocateChain(retiredHead, retiredTail);
+            return current;
         };
 
-        Node *nodePointer_;
+        /**
+         * @brief Relinks up to count link nodes starting from first in the order of their addresses
+         *        The element pointers are redistributed among them, so the order of the elements
+         *        is kept and the elements themselves stay in place
+         *
+         * @param first - first node to relink
+         * @param count - maximum number of nodes to relink
+         * @return node after the last relinked one
+         */
+        NodeBase *sortLinksByAddress(NodeBase *first, size_t count) {
+            std::vector<NodeBase *> links;
+            std::vector<T *> elements;
+            NodeBase *before = first->prev;
+            NodeBase *current = first;
+            for (; count > 0 && current != &sentinel_; count--) {
+                links.push_back(current);
+                elements.push_back(asNode(current)->data);
+                current = current->next;
+            }
+            std::sort(links.begin(), links.end(), std::less<NodeBase *>());
+
+            for (size_t i = 0; i < links.size(); i++) {
+                asNode(links[i])->data = elements[i];
+                before->next = links[i];
+                links[i]->prev = before;
+                before = links[i];
+            }
+            before->next = current;
+            current->prev = before;
+            return current;
+        };
+
+        /**
+         * @brief Returns the detached chain of nodes without data to the allocator, bypassing the node cache
+         *
+         * @param head - first node of the chain
+         * @param tail - last node of the chain
+         */
+        void deallocateChain(NodeBase *head, NodeBase *tail) noexcept {
+            while (head != nullptr) {
+                NodeBase *next = head == tail ? nullptr : head->next;
+                NodeAllocatorTraits::deallocate(nodeAllocator_, asNode(head), 1);
+                head = next;
+            }
+        };
+
+        /**
+         * @brief Merges two sorted chains of nodes linked through next and terminated by nullptr
+         *        On equal elements the nodes of first go before the nodes of second
+         *        If compare throws, merged gets all nodes of both chains in an unspecified order
+         *
+         * @param first - chain with the earlier elements
+         * @param second - chain with the later elements
+         * @param compare - strict weak ordering of the elements
+         * @param merged - result chain, it may be the variable passed as second
+         */
+        template<class Compare>
+        static void mergeChains(NodeBase *first, NodeBase *second, Compare &compare, NodeBase *&merged) {
+            NodeBase head;
+            NodeBase *tail = &head;
+            try {
+                while (first != nullptr && second != nullptr) {
+                    if (compare(valueOf(second), valueOf(first))) {
+                        tail->next = second;
+                        second = second->next;
+                    } else {
+                        tail->next = first;
+                        first = first->next;
+                    }
+                    tail = tail->next;
+                }
+            } catch (...) {
+                tail->next = first;
+                appendChain(tail, second);
+                merged = head.next;
+                throw;
+            }
+            tail->next = first != nullptr ? first : second;
+            merged = head.next;
+        };
+
+        /**
+         * @brief Appends the chain terminated by nullptr after the chain which ends at tail
+         *
+         * @param tail - any node of the chain to append to, it is moved to the last node
+         * @param chain - chain to append
+         */
+        static void appendChain(NodeBase *&tail, NodeBase *chain) noexcept {
+            while (tail->next != nullptr) {
+                tail = tail->next;
+            }
+            tail->next = chain;
+        };
+
+        /**
+         * @brief Makes the ring of the sentinel from the chain linked through next and terminated by nullptr
+         *        The prev links are restored in one pass, the size is not changed
+         *
+         * @param head - first node of the chain, it must not be nullptr
+         */
+        void linkSentinelToChain(NodeBase *head) noexcept {
+            NodeBase *prev = &sentinel_;
+            for (NodeBase *current = head; current != nullptr; current = current->next) {
+                current->prev = prev;
+                prev->next = current;
+                prev = current;
+            }
+            prev->next = &sentinel_;
+            sentinel_.prev = prev;
+            invalidatePositionalIndex();
+        };
+
+        // The parallel copies link their chains through appendSegments()
+        friend class parallel::ListConstruction;
 
-        size_t doubleLinkedListSize_;
     public:
 
+        using allocator_type = Allocator;
+
         /**
          * @class iterator
          *
@@ -52,11 +987,17 @@ namespace LinkedLists {
              * Make class iterator friend of class DoubleLinkedList
              * It allows to use private data of class iterator
              */
-            friend class DoubleLinkedList<T>;
+            friend class DoubleLinkedList<T, Allocator, NodeLayout>;
 
-            Node *iteratorPointer_;
+            NodeBase *iteratorPointer_;
         public:
 
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
             /**
              * @brief Iterator constructor by node pointer
              *        This method is used when creating
@@ -65,7 +1006,7 @@ namespace LinkedLists {
              *
              * @param pNode
              */
-            explicit iterator(Node *pNode) {
+            explicit iterator(NodeBase *pNode) {
                 iteratorPointer_ = pNode;
             };
 
@@ -119,15 +1060,15 @@ namespace LinkedLists {
              *
              * @return data, which the iterator points to
              */
-            T &operator*() {
-                return iteratorPointer_->data;
+            T &operator*() const {
+                return valueOf(iteratorPointer_);
             };
 
             /**
              * @return Pointer to data, which the iterator points to
              */
-            T *operator->() {
-                return &(iteratorPointer_->data);
+            T *operator->() const {
+                return &valueOf(iteratorPointer_);
             };
 
             /**
@@ -176,16 +1117,21 @@ namespace LinkedLists {
             /**
              *
              * @brief Offset the iterator by an arbitrary integer
+             *        It walks |shift| nodes, backwards for a negative shift
+             *        The list walks in O(log n) with iterator_at(index_of(it) + shift)
              *
              * @param shift - the offset value of the iterator
              * @param it - iterator to which the offset is applied
              * @return iterator after applying the offset
              */
-            friend iterator operator+(const int shift, const iterator &it) {
+            friend iterator operator+(const std::ptrdiff_t shift, const iterator &it) {
                 class iterator current(it);
-                for (int i = 0; i < shift; i++) {
+                for (std::ptrdiff_t i = 0; i < shift; i++) {
                     ++(current);
                 }
+                for (std::ptrdiff_t i = 0; i > shift; i--) {
+                    --(current);
+                }
                 return current;
             }
 
@@ -197,9 +1143,21 @@ namespace LinkedLists {
              * @param shift - the offset value of the iterator
              * @return iterator after applying the offset
              */
-            friend iterator operator+(const iterator &it, const int shift) {
+            friend iterator operator+(const iterator &it, const std::ptrdiff_t shift) {
                 return shift + iterator(it);
             }
+
+            /**
+             *
+             * @brief Offset the iterator backwards by an arbitrary integer
+             *
+             * @param it - iterator to which the offset is applied
+             * @param shift - the offset value of the iterator
+             * @return iterator after applying the offset
+             */
+            friend iterator operator-(const iterator &it, const std::ptrdiff_t shift) {
+                return -shift + iterator(it);
+            }
         };
 
         /**
@@ -215,11 +1173,17 @@ namespace LinkedLists {
         class const_iterator {
         private:
 
-            friend class DoubleLinkedList<T>;
+            friend class DoubleLinkedList<T, Allocator, NodeLayout>;
 
-            Node *constIteratorPointer_;
+            const NodeBase *constIteratorPointer_;
         public:
-            explicit const_iterator(Node *ptr) {
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            explicit const_iterator(const NodeBase *ptr) {
                 constIteratorPointer_ = ptr;
             };
 
@@ -243,11 +1207,11 @@ namespace LinkedLists {
             };
 
             const T &operator*() const {
-                return constIteratorPointer_->data;
+                return valueOf(constIteratorPointer_);
             };
 
             const T *operator->() const {
-                return &(constIteratorPointer_->data);
+                return &valueOf(constIteratorPointer_);
             };
 
             const_iterator &operator++() {
@@ -272,27 +1236,40 @@ namespace LinkedLists {
                 return old;
             };
 
-            friend const_iterator operator+(const int shift, const const_iterator &it) {
+            friend const_iterator operator+(const std::ptrdiff_t shift, const const_iterator &it) {
                 class const_iterator current(it);
-                for (int i = 0; i < shift; i++) {
+                for (std::ptrdiff_t i = 0; i < shift; i++) {
                     ++(current);
                 }
+                for (std::ptrdiff_t i = 0; i > shift; i--) {
+                    --(current);
+                }
                 return current;
             }
 
-            friend const_iterator operator+(const const_iterator &it, const int shift) {
+            friend const_iterator operator+(const const_iterator &it, const std::ptrdiff_t shift) {
                 return shift + const_iterator(it);
             }
+
+            friend const_iterator operator-(const const_iterator &it, const std::ptrdiff_t shift) {
+                return -shift + const_iterator(it);
+            }
         };
 
         /**
          * @brief Constructor - empty list initialization
          */
-        DoubleLinkedList() {
-            nodePointer_ = new Node();
-            nodePointer_->prev = nodePointer_;
-            nodePointer_->next = nodePointer_;
-            doubleLinkedListSize_ = 0;
+        DoubleLinkedList() noexcept(noexcept(Allocator())): DoubleLinkedList(Allocator()) {
+        };
+
+        /**
+         * @brief Constructor - empty list initialization with the given allocator
+         *        Nothing is allocated until the first insertion
+         *
+         * @param allocator - allocator used for all list nodes
+         */
+        explicit DoubleLinkedList(const Allocator &allocator) noexcept: nodeAllocator_(allocator) {
+            resetSentinel();
         };
 
         /**
@@ -301,56 +1278,85 @@ namespace LinkedLists {
          *
          * @param other - copy source
          */
-        DoubleLinkedList(const DoubleLinkedList &other) : DoubleLinkedList() {
-            doubleLinkedListSize_ = 0;
-            Node *current = other.nodePointer_->next;
-            while (current != other.nodePointer_) {
-                push_back(current->data);
-                current = current->next;
-            }
+        DoubleLinkedList(const DoubleLinkedList &other)
+                : DoubleLinkedList(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                other.get_allocator())) {
+            appendCopyOf(other);
         };
 
         /**
          * @brief Move constructor
          *        Moves full control over the existing list to the newly created object
+         *        Nodes are relinked to the new sentinel, other stays a valid empty list
+         *
+         * @param other - list, the control on which need to move
+         */
+        DoubleLinkedList(DoubleLinkedList &&other) noexcept: nodeAllocator_(other.nodeAllocator_) {
+            resetSentinel();
+            takeNodesFrom(other);
+        };
+
+        /**
+         * @brief Allocator-extended copy constructor
+         *        It copies other completely, the new nodes are taken from allocator
+         *
+         * @param other - copy source
+         * @param allocator - allocator of the new list
+         */
+        DoubleLinkedList(const DoubleLinkedList &other, const Allocator &allocator) : DoubleLinkedList(allocator) {
+            appendCopyOf(other);
+        };
+
+        /**
+         * @brief Allocator-extended move constructor
+         *        The nodes of other are taken over if its allocator is equal to allocator,
+         *        otherwise the elements are moved into the nodes taken from allocator
          *
          * @param other - list, the control on which need to move
+         * @param allocator - allocator of the new list
          */
-        DoubleLinkedList(DoubleLinkedList &&other) noexcept: DoubleLinkedList() {
-            nodePointer_ = other.nodePointer_;
-            doubleLinkedListSize_ = other.doubleLinkedListSize_;
-            other.doubleLinkedListSize_ = 0;
-            other.nodePointer_ = nullptr;
+        DoubleLinkedList(DoubleLinkedList &&other, const Allocator &allocator) : DoubleLinkedList(allocator) {
+            if (nodeAllocator_ == other.nodeAllocator_) {
+                takeNodesFrom(other);
+            } else {
+                appendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            }
         };
 
         /**
          * @brief Destructor
-         *        Clear non-empty list and delete single node pointer
+         *        Clear non-empty list and return cached nodes to the allocator
          */
         ~DoubleLinkedList() {
             if (!empty()) {
                 clear();
             }
-            delete nodePointer_;
+            shrink_to_fit();
         };
 
         /**
          * @brief Copy assignment
          *        It rewrites an existing list from another existing list by copying it completely
+         *        The allocator of other is taken only if it propagates on copy assignment
          *
          * @param other - the list to copy from
          * @return rewritten existing list
          */
         DoubleLinkedList &operator=(const DoubleLinkedList &other) {
             if (this != &other) {
-                if (!empty()) {
-                    clear();
+                if constexpr (NodeAllocatorTraits::propagate_on_container_copy_assignment::value) {
+                    if (nodeAllocator_ != other.nodeAllocator_) {
+                        // Nodes and cached nodes must be returned to the allocator they came from
+                        clear();
+                        shrink_to_fit();
+                    }
+                    nodeAllocator_ = other.nodeAllocator_;
                 }
-                Node *current = other.nodePointer_->next;
-                while (current != other.nodePointer_) {
-                    push_back(current->data);
-                    current = current->next;
+                if (other.size() > size()) {
+                    prepareNodes(other.size() - size());
                 }
+                assign(other.cbegin(), other.cend());
             }
             return *this;
         };
@@ -358,64 +1364,372 @@ namespace LinkedLists {
         /**
          * @brief Move assignment
          *        It rewrites an existing list from another existing list by moving it completely
+         *        The nodes of other are relinked to the current sentinel without allocations,
+         *        other stays a valid empty list
+         *        If the allocators do not propagate and are not equal, the nodes can't be
+         *        taken over and the elements are moved into the existing and new nodes instead
          *
          * @param other - the list to move from
          * @return rewritten existing list
          */
-        DoubleLinkedList &operator=(DoubleLinkedList &&other) noexcept {
+        DoubleLinkedList &operator=(DoubleLinkedList &&other) noexcept(
+                NodeAllocatorTraits::propagate_on_container_move_assignment::value ||
+                NodeAllocatorTraits::is_always_equal::value) {
             if (this != &other) {
+                if constexpr (!NodeAllocatorTraits::propagate_on_container_move_assignment::value) {
+                    if (nodeAllocator_ != other.nodeAllocator_) {
+                        assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                        other.clear();
+                        return *this;
+                    }
+                }
                 if (!empty()) {
                     clear();
                 }
-                delete nodePointer_;
-                nodePointer_ = other.nodePointer_;
-                doubleLinkedListSize_ = other.doubleLinkedListSize_;
-                other.doubleLinkedListSize_ = 0;
-                other.nodePointer_ = nullptr;
+                if constexpr (NodeAllocatorTraits::propagate_on_container_move_assignment::value) {
+                    if (nodeAllocator_ != other.nodeAllocator_) {
+                        shrink_to_fit();
+                    }
+                    nodeAllocator_ = other.nodeAllocator_;
+                }
+                takeNodesFrom(other);
             }
             return *this;
         };
 
+        /**
+         * @brief Exchanges the contents of two lists without allocations
+         *        The allocators are exchanged only if they propagate on swap,
+         *        otherwise they must be equal
+         *
+         * @param other - the list to exchange with
+         */
+        void swap(DoubleLinkedList &other) noexcept {
+            if (this == &other) {
+                return;
+            }
+            if constexpr (NodeAllocatorTraits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(nodeAllocator_, other.nodeAllocator_);
+                // Cached nodes stay with the allocator they were taken from
+                std::swap(cachedNodes_, other.cachedNodes_);
+                std::swap(cachedNodesCount_, other.cachedNodesCount_);
+            }
+            // Both sentinels stay in place, the rings are relinked to them
+            NodeBase *head = empty() ? nullptr : sentinel_.next;
+            NodeBase *tail = sentinel_.prev;
+            NodeBase *otherHead = other.empty() ? nullptr : other.sentinel_.next;
+            linkSentinel(sentinel_, otherHead, other.sentinel_.prev);
+            linkSentinel(other.sentinel_, head, tail);
+            std::swap(doubleLinkedListSize_, other.doubleLinkedListSize_);
+            std::swap(compactCursor_, other.compactCursor_);
+            invalidatePositionalIndex();
+            other.invalidatePositionalIndex();
+        };
+
+        /**
+         * @brief Replaces the contents with copies of the elements from first to last (not include)
+         *        The existing nodes get the new data by assignment, only the difference
+         *        in the number of elements is allocated or freed
+         *
+         * @param first - iterator to the first element to copy
+         * @param last - iterator to the element after the last one to copy
+         */
+        template<class InputIterator, class = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+        void assign(InputIterator first, InputIterator last) {
+            NodeBase *current = sentinel_.next;
+            while (current != &sentinel_ && first != last) {
+                valueOf(current) = *first;
+                current = current->next;
+                ++first;
+            }
+            if (first == last) {
+                erase(iterator(current), end());
+            } else {
+                appendRange(first, last);
+            }
+        };
+
+        /**
+         * @brief Replaces the contents with count copies of value
+         *        The existing nodes get the new data by assignment, only the difference
+         *        in the number of elements is allocated or freed
+         *
+         * @param count - new size of the list
+         * @param value - data of all elements
+         */
+        void assign(size_t count, const T &value) {
+            NodeBase *current = sentinel_.next;
+            size_t assigned = 0;
+            while (current != &sentinel_ && assigned < count) {
+                valueOf(current) = value;
+                current = current->next;
+                ++assigned;
+            }
+            if (assigned == count) {
+                erase(iterator(current), end());
+                return;
+            }
+
+            size_t missing = count - assigned;
+            prepareNodes(missing);
+            NodeBase *head = nullptr;
+            NodeBase *tail = nullptr;
+            try {
+                for (size_t i = 0; i < missing; i++) {
+                    appendToChain(head, tail, createNode(value));
+                }
+            } catch (...) {
+                destroyChain(head, tail);
+                throw;
+            }
+            linkChain(&sentinel_, head, tail, missing);
+        };
+
+        /**
+         * @return copy of the allocator used by the list
+         */
+        allocator_type get_allocator() const {
+            return allocator_type(nodeAllocator_);
+        };
+
+        /**
+         * @brief Sets how many nodes ahead the whole-list walks prefetch
+         *        The walks are remove(), clear(), equals(), the output operator and for_each_prefetched()
+         *        Zero distance (the default) disables prefetching. It pays off when the work
+         *        per element is long enough to cover the load of the next nodes
+         *
+         * @param distance - number of nodes ahead of the visited one
+         */
+        void set_prefetch_distance(size_t distance) {
+            prefetchDistance_ = distance;
+        };
+
+        /**
+         * @return number of nodes which the whole-list walks prefetch ahead
+         */
+        [[nodiscard]] size_t prefetch_distance() const {
+            return prefetchDistance_;
+        };
+
+        /**
+         * @brief Calls function for every element in the list order
+         *        The nodes prefetch_distance() positions ahead are requested from memory
+         *        while the current element is processed, which hides the latency of lists
+         *        that do not fit in the cache
+         *
+         * @param function - function called with the reference to every element
+         * @return function after the walk
+         */
+        template<class Function>
+        Function for_each_prefetched(Function function) {
+            walkPrefetched(&sentinel_, prefetchDistance_, [&function](NodeBase *node) {
+                function(valueOf(node));
+            });
+            return function;
+        };
+
+        template<class Function>
+        Function for_each_prefetched(Function function) const {
+            walkPrefetched(&sentinel_, prefetchDistance_, [&function](const NodeBase *node) {
+                function(valueOf(node));
+            });
+            return function;
+        };
+
+        /**
+         * @brief Compares two lists element by element, both walks prefetch their nodes ahead
+         *
+         * @param other - list to compare with
+         * @return true, if the lists are equal
+         *         false, if not
+         */
+        [[nodiscard]] bool equals(const DoubleLinkedList &other) const {
+            if (this == &other) {
+                return true;
+            }
+            if (size() != other.size()) {
+                return false;
+            }
+
+            const NodeBase *left = sentinel_.next;
+            const NodeBase *right = other.sentinel_.next;
+            const NodeBase *leftAhead = left;
+            const NodeBase *rightAhead = right;
+            for (size_t i = 0; i < prefetchDistance_; i++) {
+                prefetchAhead(leftAhead, &sentinel_);
+                prefetchAhead(rightAhead, &other.sentinel_);
+            }
+            while (left != &sentinel_) {
+                prefetchAhead(leftAhead, &sentinel_);
+                prefetchAhead(rightAhead, &other.sentinel_);
+                if (valueOf(left) != valueOf(right)) {
+                    return false;
+                }
+                left = left->next;
+                right = right->next;
+            }
+            return true;
+        };
+
+        /**
+         * @brief Enables reuse of erased nodes
+         *        Up to limit erased nodes are kept inside the list and the next insertions
+         *        take them instead of calling the allocator. Zero limit disables the reuse
+         *
+         * @param limit - maximum number of cached nodes
+         */
+        void set_node_cache_limit(size_t limit) {
+            nodeCacheLimit_ = limit;
+            while (cachedNodesCount_ > nodeCacheLimit_) {
+                NodeBase *node = cachedNodes_;
+                cachedNodes_ = node->next;
+                --cachedNodesCount_;
+                NodeAllocatorTraits::deallocate(nodeAllocator_, asNode(node), 1);
+            }
+        };
+
+        /**
+         * @return maximum number of cached nodes
+         */
+        [[nodiscard]] size_t node_cache_limit() const {
+            return nodeCacheLimit_;
+        };
+
+        /**
+         * @return number of nodes which are allocated and ready for the next insertions
+         */
+        [[nodiscard]] size_t cached_nodes() const {
+            return cachedNodesCount_;
+        };
+
+        /**
+         * @return number of elements the list can hold without calling the allocator
+         */
+        [[nodiscard]] size_t capacity() const {
+            return doubleLinkedListSize_ + cachedNodesCount_;
+        };
+
+        /**
+         * @brief Preallocates nodes so that the list can hold count elements without calling the allocator
+         *        The node cache limit is raised if it is not enough to keep these nodes
+         *
+         * @param count - number of elements to reserve space for
+         */
+        void reserve(size_t count) {
+            if (count <= capacity()) {
+                return;
+            }
+            size_t missingNodes = count - capacity();
+            if (nodeCacheLimit_ < cachedNodesCount_ + missingNodes) {
+                nodeCacheLimit_ = cachedNodesCount_ + missingNodes;
+            }
+            if constexpr (AllocatorReservesInAdvance<NodeAllocator>::value) {
+                nodeAllocator_.reserve(missingNodes);
+            }
+            for (size_t i = 0; i < missingNodes; i++) {
+                releaseNode(NodeAllocatorTraits::allocate(nodeAllocator_, 1));
+            }
+        };
+
+        /**
+         * @brief Returns all cached nodes to the allocator
+         *        The node cache limit is not changed
+         */
+        void shrink_to_fit() {
+            while (cachedNodes_ != nullptr) {
+                NodeBase *node = cachedNodes_;
+                cachedNodes_ = node->next;
+                NodeAllocatorTraits::deallocate(nodeAllocator_, asNode(node), 1);
+            }
+            cachedNodesCount_ = 0;
+        };
+
+        /**
+         * @brief Restores the traversal locality lost after many random insertions and erasures
+         *        With InlineNodeLayout the elements are moved into freshly allocated nodes in the list order,
+         *        so the allocator hands out adjacent memory for neighbouring elements
+         *        With SplitNodeLayout the elements are not moved: the link nodes are relinked
+         *        in the order of their addresses and the element pointers are redistributed among them
+         *
+         *        The work may be split between calls: every call handles at most stepBudget nodes
+         *        and the next call continues from the place where the previous one stopped
+         *        Iterators to the handled elements are invalidated, with SplitNodeLayout
+         *        references to the elements stay valid
+         *
+         *        With InlineNodeLayout the old nodes go straight back to the allocator, not to the node cache
+         *        With an allocator which releases its memory in bulk (see AllocatorReleasesInBulk),
+         *        such as ArenaAllocator, they are not reused: every pass grows the arena by the size of the list
+         *        To get the memory back, copy the list into a list bound to a fresh arena and release the old one
+         *
+         * @param stepBudget - maximum number of nodes to handle in this call
+         * @return true, if the pass over the list is finished
+         *         false, if the next call has to continue it
+         */
+        bool compact(size_t stepBudget = std::numeric_limits<size_t>::max()) {
+            static_assert(splitNodeLayout_ || std::is_move_constructible_v<T>,
+                          "compact() moves the elements of InlineNodeLayout, use SplitNodeLayout for immovable T");
+            NodeBase *first = compactCursor_ == nullptr ? sentinel_.next : compactCursor_;
+            if (first == &sentinel_) {
+                compactCursor_ = nullptr;
+                return true;
+            }
+            if (stepBudget == 0) {
+                return false;
+            }
+
+            // The nodes are replaced or take other elements
+            invalidatePositionalIndex();
+            NodeBase *next;
+            if constexpr (splitNodeLayout_) {
+                next = sortLinksByAddress(first, stepBudget);
+            } else {
+                next = relocateNodes(first, stepBudget);
+            }
+            compactCursor_ = next == &sentinel_ ? nullptr : next;
+            return compactCursor_ == nullptr;
+        };
+
         /**
          * @return non-const iterator that points to the first element in the list
          */
         iterator begin() {
-            return iterator(nodePointer_->next);
+            return iterator(sentinel_.next);
         };
 
         /**
          * @return const iterator that points to the first element in the list
          */
         const_iterator begin() const {
-            return const_iterator(nodePointer_->next);
+            return const_iterator(sentinel_.next);
         };
 
         /**
          * @return const iterator that points to the first element in the list
          */
         const_iterator cbegin() const {
-            return const_iterator(nodePointer_->next);
+            return const_iterator(sentinel_.next);
         };
 
         /**
          * @return non-const iterator that points to the element after the last one in the list
          */
         iterator end() {
-            return iterator(nodePointer_);
+            return iterator(&sentinel_);
         };
 
         /**
          * @return const iterator that points to the element after the last one in the list
          */
         const_iterator end() const {
-            return const_iterator(nodePointer_);
+            return const_iterator(&sentinel_);
         };
 
         /**
          * @return const iterator that points to the element after the last one in the list
          */
         const_iterator cend() const {
-            return const_iterator(nodePointer_);
+            return const_iterator(&sentinel_);
         };
 
         /**
@@ -440,7 +1754,7 @@ namespace LinkedLists {
          */
         T &front() {
             if (!empty()) {
-                return nodePointer_->next->data;
+                return valueOf(sentinel_.next);
             } else {
                 throw LinkedLists::LinkedListsException("Can't return a reference to the first item in the list");
             }
@@ -449,40 +1763,136 @@ namespace LinkedLists {
         /**
          * @throw LinkedLists::LinkedListsException
          *
-         * @return the const reference to the first element in the list
+         * @return the const reference to the first element in the list
+         */
+        const T &front() const {
+            if (!empty()) {
+                return valueOf(sentinel_.next);
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the first item in the list");
+            }
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the last element in the list
+         */
+        T &back() {
+            if (!empty()) {
+                return valueOf(sentinel_.prev);
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the last item in the list");
+            }
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the const reference to the last element in the list
+         */
+        const T &back() const {
+            if (!empty()) {
+                return valueOf(sentinel_.prev);
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the last item in the list");
+            }
+        };
+
+        /**
+         * @brief Enables or disables the order-statistic index of the positional access
+         *        With the index at(), iterator_at() and index_of() take O(log n) expected time,
+         *        the cost is O(log n) per insert() and erase() and, on a 64-bit platform, about 100 bytes
+         *        per element: a 48-byte treap entry, an 8-byte slot of its free list and a node
+         *        and a bucket of std::unordered_map (about 40 bytes with the malloc overhead)
+         *        Bulk relinking (splice, sort, merge, remove_if, reverse, ...) marks the index stale,
+         *        the next non-const positional call rebuilds it in O(n), the const ones walk the list until then
+         *        The index memory is not taken from the list allocator
+         *
+         * @param enabled - true to build the index, false to drop it
+         */
+        void set_positional_index(bool enabled) {
+            positionalIndex_.clear();
+            positionalIndexEnabled_ = enabled;
+            positionalIndexStale_ = true;
+            refreshPositionalIndex();
+        };
+
+        /**
+         * @return true, if the positional index is enabled
+         */
+        [[nodiscard]] bool has_positional_index() const {
+            return positionalIndexEnabled_;
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param position - position of the element, less than size()
+         * @return reference to the element at the position
          */
-        const T &front() const {
-            if (!empty()) {
-                return nodePointer_->next->data;
+        T &at(size_t position) {
+            if (position < doubleLinkedListSize_) {
+                return *iterator_at(position);
             } else {
-                throw LinkedLists::LinkedListsException("Can't return a const reference to the first item in the list");
+                throw LinkedLists::LinkedListsException("Can't return a reference to the element out of the list in at method");
+            }
+        };
+
+        const T &at(size_t position) const {
+            if (position < doubleLinkedListSize_) {
+                return *iterator_at(position);
+            } else {
+                throw LinkedLists::LinkedListsException(
+                        "Can't return a const reference to the element out of the list in at method");
             }
         };
 
         /**
+         * @brief Finds the element at the position in O(log n) with the positional index,
+         *        otherwise walks from the nearest of the finger, the begin and the end of the list
+         *        The non-const call remembers the found node as the finger, so a scan by ascending
+         *        or descending positions takes amortized O(1) per step
+         *
          * @throw LinkedLists::LinkedListsException
          *
-         * @return the non-const reference to the last element in the list
+         * @param position - position of the element, size() gives end()
+         * @return iterator to the element at the position
          */
-        T &back() {
-            if (!empty()) {
-                return nodePointer_->prev->data;
-            } else {
-                throw LinkedLists::LinkedListsException("Can't return a reference to the last item in the list");
+        iterator iterator_at(size_t position) {
+            if (position > doubleLinkedListSize_) {
+                throw LinkedLists::LinkedListsException("Can't return an iterator out of the list in iterator_at method");
+            }
+            refreshPositionalIndex();
+            const NodeBase *node = nodeAt(position);
+            setFinger(node, position);
+            return iterator(const_cast<NodeBase *>(node));
+        };
+
+        const_iterator iterator_at(size_t position) const {
+            if (position > doubleLinkedListSize_) {
+                throw LinkedLists::LinkedListsException("Can't return an iterator out of the list in iterator_at method");
             }
+            return const_iterator(nodeAt(position));
         };
 
         /**
-         * @throw LinkedLists::LinkedListsException
+         * @brief Finds the position of the element in O(log n) with the positional index,
+         *        otherwise counts it from the begin of the list
+         *        iterator_at(index_of(it) + shift) moves an iterator by a signed shift in O(log n)
          *
-         * @return the const reference to the last element in the list
+         * @param position - iterator of the current list
+         * @return position of the element, size() for end()
          */
-        const T &back() const {
-            if (!empty()) {
-                return nodePointer_->prev->data;
-            } else {
-                throw LinkedLists::LinkedListsException("Can't return a const reference to the last item in the list");
-            }
+        size_t index_of(iterator position) {
+            refreshPositionalIndex();
+            size_t index = positionOf(position.iteratorPointer_);
+            setFinger(position.iteratorPointer_, index);
+            return index;
+        };
+
+        size_t index_of(const_iterator position) const {
+            return positionOf(position.constIteratorPointer_);
         };
 
         /**
@@ -496,12 +1906,24 @@ namespace LinkedLists {
 
                 --doubleLinkedListSize_;
 
-                Node *saveNextNode = position.iteratorPointer_->next;
-                Node *savePrevNode = position.iteratorPointer_->prev;
+                NodeBase *saveNextNode = position.iteratorPointer_->next;
+                NodeBase *savePrevNode = position.iteratorPointer_->prev;
+                if (position.iteratorPointer_ == compactCursor_) {
+                    compactCursor_ = saveNextNode == &sentinel_ ? nullptr : saveNextNode;
+                }
+                if (positionalIndexReady()) {
+                    positionalIndex_.erase(position.iteratorPointer_);
+                }
+                // The positions before the erased node do not change
+                if (position.iteratorPointer_ == fingerNode_) {
+                    fingerNode_ = saveNextNode == &sentinel_ ? nullptr : saveNextNode;
+                } else if (saveNextNode != &sentinel_) {
+                    fingerNode_ = nullptr;
+                }
                 savePrevNode->next = saveNextNode;
                 saveNextNode->prev = savePrevNode;
                 iterator current(saveNextNode);
-                delete position.iteratorPointer_;
+                destroyNode(asNode(position.iteratorPointer_));
                 return current;
             } else {
                 throw LinkedLists::LinkedListsException("Can't erase a nonexistent element in erase method");
@@ -525,33 +1947,86 @@ namespace LinkedLists {
         };
 
         /**
-         * @brief Delete all list elements which contains data = value by using iterators
+         * @brief Delete all list elements which contains data = value
+         *        The elements are destroyed after the scan, so value may refer to an element of the list
          *
          * @param value - the data elements which will be deleted
          * @return number of deleted elements in the list
          */
         size_t remove(const T &value) {
-            size_t counter = 0;
-            iterator current = begin();
-            while (current != end()) {
-                if (current.iteratorPointer_->data == value) {
-                    current = erase(current);
-                    ++counter;
-                } else {
-                    ++current;
+            return remove_if([&value](const T &element) {
+                return element == value;
+            });
+        };
+
+        /**
+         * @brief Deletes all elements for which predicate returns true in one pass
+         *        Runs of adjacent matches are unlinked at once and freed together after the scan
+         *
+         * @param predicate - function called once for every element
+         * @return number of deleted elements in the list
+         */
+        template<class Predicate>
+        size_t remove_if(Predicate predicate) {
+            return removeMarkedNodes([&predicate](NodeBase *node) {
+                return predicate(valueOf(node));
+            });
+        };
+
+        /**
+         * @brief Deletes all elements which are contained in values in one pass
+         *        instead of a remove() call per value
+         *
+         * @param values - set of the values to delete, it is searched by find()
+         * @return number of deleted elements in the list
+         */
+        template<class Set>
+        size_t remove_any(const Set &values) {
+            return remove_if([&values](const T &element) {
+                return values.find(element) != values.end();
+            });
+        };
+
+        /**
+         * @brief Deletes all but the first element from every group of consecutive equal elements
+         *
+         * @return number of deleted elements in the list
+         */
+        size_t unique() {
+            return unique(std::equal_to<T>());
+        };
+
+        /**
+         * @brief Deletes every element for which predicate(kept, element) returns true,
+         *        where kept is the last element before it which stays in the list
+         *        Runs of deleted elements are unlinked at once and freed together after the scan
+         *
+         * @param predicate - binary predicate of the equality
+         * @return number of deleted elements in the list
+         */
+        template<class BinaryPredicate>
+        size_t unique(BinaryPredicate predicate) {
+            NodeBase *kept = nullptr;
+            return removeMarkedNodes([&predicate, &kept](NodeBase *node) {
+                if (kept != nullptr && predicate(valueOf(kept), valueOf(node))) {
+                    return true;
                 }
-            }
-            return counter;
+                kept = node;
+                return false;
+            });
         };
 
         /**
          * @brief Clear current list
+         *        It takes O(1) for trivially destructible T when the allocator releases memory in bulk
          */
         void clear() {
-            iterator current = begin();
-            while (current != end()) {
-                current = erase(current);
+            if constexpr (!dropNodesInBulk_) {
+                walkPrefetched(&sentinel_, prefetchDistance_, [this](NodeBase *node) {
+                    destroyNode(asNode(node));
+                });
             }
+            resetSentinel();
         };
 
         /**
@@ -577,6 +2052,15 @@ namespace LinkedLists {
             insert(end(), value);
         };
 
+        /**
+         * @brief Insert the new element in the end of the list by moving value into it
+         *
+         * @param value - data of new element
+         */
+        void push_back(T &&value) {
+            insert(end(), std::move(value));
+        };
+
         /**
          * @brief Insert the new element with data = value in the begin of the list
          *
@@ -587,17 +2071,63 @@ namespace LinkedLists {
         };
 
         /**
-         * @brief Inserts the new element with data = value before the element pointed to by before
+         * @brief Insert the new element in the begin of the list by moving value into it
+         *
+         * @param value - data of new element
+         */
+        void push_front(T &&value) {
+            insert(begin(), std::move(value));
+        };
+
+        /**
+         * @brief Constructs the new element in the end of the list from args
+         *
+         * @param args - arguments forwarded to the constructor of T
+         * @return reference to the new element
+         */
+        template<class... Args>
+        T &emplace_back(Args &&... args) {
+            return *emplace(end(), std::forward<Args>(args)...);
+        };
+
+        /**
+         * @brief Constructs the new element in the begin of the list from args
+         *
+         * @param args - arguments forwarded to the constructor of T
+         * @return reference to the new element
+         */
+        template<class... Args>
+        T &emplace_front(Args &&... args) {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        };
+
+        /**
+         * @brief Constructs the new element before the element pointed to by before
+         *        The element is constructed directly inside the node without copies
          *
          * @param before - iterator, before which need to add a new element
-         * @param value - new element data
+         * @param args - arguments forwarded to the constructor of T
          * @return iterator that points to the new element in the list
          */
-        iterator insert(iterator before, const T &value) {
-            Node *newNode = new Node();
-            newNode->data = value;
+        template<class... Args>
+        iterator emplace(iterator before, Args &&... args) {
+            Node *newNode = createNode(std::forward<Args>(args)...);
+            if (positionalIndexReady()) {
+                try {
+                    positionalIndex_.insert(positionOf(before.iteratorPointer_), newNode);
+                } catch (...) {
+                    // The insertion itself succeeds, the index is rebuilt later
+                    invalidatePositionalIndex();
+                }
+            }
+            // The new node takes the position of before, the positions before it do not change
+            if (before.iteratorPointer_ == fingerNode_) {
+                fingerNode_ = newNode;
+            } else if (before.iteratorPointer_ != &sentinel_) {
+                fingerNode_ = nullptr;
+            }
 
-            Node *savePrevBefore = before.iteratorPointer_->prev;
+            NodeBase *savePrevBefore = before.iteratorPointer_->prev;
             savePrevBefore->next = newNode;
             newNode->next = before.iteratorPointer_;
             before.iteratorPointer_->prev = newNode;
@@ -608,6 +2138,28 @@ namespace LinkedLists {
             return iterator(newNode);
         };
 
+        /**
+         * @brief Inserts the new element with data = value before the element pointed to by before
+         *
+         * @param before - iterator, before which need to add a new element
+         * @param value - new element data
+         * @return iterator that points to the new element in the list
+         */
+        iterator insert(iterator before, const T &value) {
+            return emplace(before, value);
+        };
+
+        /**
+         * @brief Inserts the new element before the element pointed to by before by moving value into it
+         *
+         * @param before - iterator, before which need to add a new element
+         * @param value - new element data
+         * @return iterator that points to the new element in the list
+         */
+        iterator insert(iterator before, T &&value) {
+            return emplace(before, std::move(value));
+        };
+
         /**
          * @brief Adds another existing list to the end of the current list
          *
@@ -619,16 +2171,386 @@ namespace LinkedLists {
                 return *this;
             }
 
-            Node *currentOtherNode = other.nodePointer_->next;
-            while (currentOtherNode != other.nodePointer_) {
-                push_back(currentOtherNode->data);
-                currentOtherNode = currentOtherNode->next;
+            appendCopyOf(other);
+
+            return *this;
+        };
+
+        /**
+         * @brief Adds another list to the end of the current list by relinking its nodes
+         *        If the allocators are not equal, the elements are moved into new nodes instead
+         *
+         * @param other - the list that will be attached to the end of the current one, it becomes empty
+         * @return advanced existing list
+         */
+        DoubleLinkedList &operator+=(DoubleLinkedList &&other) {
+            if (this == &other || other.empty()) {
+                return *this;
+            }
+
+            if (nodeAllocator_ == other.nodeAllocator_) {
+                splice(end(), other);
+            } else {
+                appendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
             }
 
             return *this;
         };
+
+        /**
+         * @brief Moves all elements of other before the element pointed to by before
+         *        Nodes are relinked in O(1), nothing is allocated or copied
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param before - iterator of the current list, before which the elements are placed
+         * @param other - another list with an equal allocator, it becomes empty
+         */
+        void splice(iterator before, DoubleLinkedList &other) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            checkSpliceAllocator(other);
+
+            NodeBase *head = other.sentinel_.next;
+            NodeBase *tail = other.sentinel_.prev;
+            size_t count = other.doubleLinkedListSize_;
+            other.resetSentinel();
+            // The nodes may be linked in behind the cursor of an interrupted compact() pass
+            compactCursor_ = nullptr;
+            linkChain(before.iteratorPointer_, head, tail, count);
+        };
+
+        void splice(iterator before, DoubleLinkedList &&other) {
+            splice(before, other);
+        };
+
+        /**
+         * @brief Moves the element pointed to by position from other before the element pointed to by before
+         *        Nodes are relinked in O(1), nothing is allocated or copied
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param before - iterator of the current list, before which the element is placed
+         * @param other - list which owns the element, it may be the current list
+         * @param position - iterator to the element to move
+         */
+        void splice(iterator before, DoubleLinkedList &other, iterator position) {
+            if (position == other.end()) {
+                throw LinkedLists::LinkedListsException("Can't splice a nonexistent element in splice method");
+            }
+            NodeBase *node = position.iteratorPointer_;
+            if (node == before.iteratorPointer_ || node->next == before.iteratorPointer_) {
+                return;
+            }
+            checkSpliceAllocator(other);
+
+            unlinkRange(node, node->next);
+            --other.doubleLinkedListSize_;
+            other.invalidatePositionalIndex();
+            if (node == other.compactCursor_) {
+                other.compactCursor_ = nullptr;
+            }
+            // The node may be linked in behind the cursor of an interrupted compact() pass
+            compactCursor_ = nullptr;
+            linkChain(before.iteratorPointer_, node, node, 1);
+        };
+
+        void splice(iterator before, DoubleLinkedList &&other, iterator position) {
+            splice(before, other, position);
+        };
+
+        /**
+         * @brief Moves the elements from first to last (not include) of other before the element pointed to by before
+         *        Nodes are relinked without allocations. It takes O(1) within one list,
+         *        the number of moved elements is counted if they come from another list
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param before - iterator of the current list, before which the elements are placed,
+         *                 it must not be in the range
+         * @param other - list which owns the elements, it may be the current list
+         * @param first - iterator to the first element to move
+         * @param last - iterator to the element after the last one to move
+         */
+        void splice(iterator before, DoubleLinkedList &other, iterator first, iterator last) {
+            if (first == last || first.iteratorPointer_ == before.iteratorPointer_) {
+                return;
+            }
+            checkSpliceAllocator(other);
+
+            size_t count = 0;
+            if (this != &other) {
+                for (NodeBase *current = first.iteratorPointer_; current != last.iteratorPointer_;
+                     current = current->next) {
+                    ++count;
+                }
+            }
+
+            NodeBase *head = first.iteratorPointer_;
+            NodeBase *tail = last.iteratorPointer_->prev;
+            unlinkRange(head, last.iteratorPointer_);
+            other.doubleLinkedListSize_ -= count;
+            other.invalidatePositionalIndex();
+            // The cursor of other may be among the moved nodes, and the moved range reorders the current list
+            // as reverse() and rotate() do
+            other.compactCursor_ = nullptr;
+            compactCursor_ = nullptr;
+            linkChain(before.iteratorPointer_, head, tail, count);
+        };
+
+        void splice(iterator before, DoubleLinkedList &&other, iterator first, iterator last) {
+            splice(before, other, first, last);
+        };
+
+        /**
+         * @brief Reverses the order of the elements in place
+         *        The prev and next links are exchanged in every node and in the sentinel,
+         *        nothing is allocated and all iterators stay valid
+         */
+        void reverse() noexcept {
+            // An interrupted compact() pass would continue in the other direction
+            compactCursor_ = nullptr;
+            invalidatePositionalIndex();
+            NodeBase *current = &sentinel_;
+            do {
+                std::swap(current->prev, current->next);
+                // The old next link is the new prev one
+                current = current->prev;
+            } while (current != &sentinel_);
+        };
+
+        /**
+         * @brief Rotates the list so that newFirst becomes its first element in O(1)
+         *        The ring of the nodes is not changed: only the sentinel is unlinked from
+         *        between the last and the first nodes and linked before newFirst
+         *        All iterators stay valid
+         *
+         * @param newFirst - iterator to the element which becomes the first one, end() does nothing
+         */
+        void rotate(iterator newFirst) noexcept {
+            NodeBase *newHead = newFirst.iteratorPointer_;
+            if (newHead == &sentinel_ || newHead == sentinel_.next) {
+                return;
+            }
+            NodeBase *head = sentinel_.next;
+            NodeBase *tail = sentinel_.prev;
+            tail->next = head;
+            head->prev = tail;
+
+            NodeBase *newTail = newHead->prev;
+            newTail->next = &sentinel_;
+            sentinel_.prev = newTail;
+            sentinel_.next = newHead;
+            newHead->prev = &sentinel_;
+            // An interrupted compact() pass would continue from the wrong place
+            compactCursor_ = nullptr;
+            invalidatePositionalIndex();
+        };
+
+        /**
+         * @brief Sorts the list in ascending order by operator<
+         *        Implementation features are described in sort(compare)
+         */
+        void sort() {
+            sort(std::less<T>());
+        };
+
+        /**
+         * @brief Sorts the list by the stable bottom-up merge sort in O(n log n)
+         *        Only the links are changed: the elements are not moved or copied, nothing is allocated
+         *        and all iterators stay valid. Runs of 2^i nodes are kept in 64 bins on the stack
+         *        If compare throws, all elements stay in the list in an unspecified order
+         *
+         * @param compare - strict weak ordering of the elements
+         */
+        template<class Compare>
+        void sort(Compare compare) {
+            if (doubleLinkedListSize_ < 2) {
+                return;
+            }
+
+            NodeBase *bins[64] = {};
+            NodeBase *chain = sentinel_.next;
+            sentinel_.prev->next = nullptr;
+            NodeBase *run = nullptr;
+            try {
+                while (chain != nullptr) {
+                    run = chain;
+                    chain = chain->next;
+                    run->next = nullptr;
+                    size_t bin = 0;
+                    for (; bins[bin] != nullptr; bin++) {
+                        NodeBase *earlier = bins[bin];
+                        bins[bin] = nullptr;
+                        mergeChains(earlier, run, compare, run);
+                    }
+                    bins[bin] = run;
+                    run = nullptr;
+                }
+                // Higher bins hold the earlier elements
+                for (NodeBase *&bin : bins) {
+                    if (bin != nullptr) {
+                        NodeBase *earlier = bin;
+                        bin = nullptr;
+                        if (run == nullptr) {
+                            run = earlier;
+                        } else {
+                            mergeChains(earlier, run, compare, run);
+                        }
+                    }
+                }
+            } catch (...) {
+                NodeBase head;
+                head.next = run;
+                NodeBase *tail = &head;
+                for (NodeBase *bin : bins) {
+                    appendChain(tail, bin);
+                }
+                appendChain(tail, chain);
+                // An interrupted compact() pass would continue from the wrong place
+                compactCursor_ = nullptr;
+                linkSentinelToChain(head.next);
+                throw;
+            }
+            compactCursor_ = nullptr;
+            linkSentinelToChain(run);
+        };
+
+        /**
+         * @brief Merges the sorted list other into the current sorted list by operator<
+         *        Implementation features are described in merge(other, compare)
+         *
+         * @param other - sorted list, it becomes empty
+         */
+        void merge(DoubleLinkedList &other) {
+            merge(other, std::less<T>());
+        };
+
+        void merge(DoubleLinkedList &&other) {
+            merge(other, std::less<T>());
+        };
+
+        /**
+         * @brief Merges the sorted list other into the current sorted list in one pass, O(n + m)
+         *        The nodes of other are relinked in runs, nothing is allocated or copied.
+         *        On equal elements the elements of the current list go first
+         *        If the allocators are not equal, the elements of other are moved into new nodes first
+         *        If compare throws, the elements merged so far stay in the current list, the rest stay in other
+         *
+         * @param other - list sorted by compare, it becomes empty
+         * @param compare - strict weak ordering of the elements, the current list is sorted by it
+         */
+        template<class Compare>
+        void merge(DoubleLinkedList &other, Compare compare) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            if constexpr (!NodeAllocatorTraits::is_always_equal::value) {
+                if (nodeAllocator_ != other.nodeAllocator_) {
+                    DoubleLinkedList movedList(std::move(other), get_allocator());
+                    merge(movedList, compare);
+                    return;
+                }
+            }
+
+            // The nodes of other are going to leave it, in the current list
+            // they are linked in behind the cursor of an interrupted compact() pass
+            other.compactCursor_ = nullptr;
+            other.invalidatePositionalIndex();
+            compactCursor_ = nullptr;
+            NodeBase *current = sentinel_.next;
+            NodeBase *otherCurrent = other.sentinel_.next;
+            while (otherCurrent != &other.sentinel_) {
+                while (current != &sentinel_ && !compare(valueOf(otherCurrent), valueOf(current))) {
+                    current = current->next;
+                }
+                if (current == &sentinel_) {
+                    NodeBase *otherTail = other.sentinel_.prev;
+                    size_t count = other.doubleLinkedListSize_;
+                    unlinkRange(otherCurrent, &other.sentinel_);
+                    other.doubleLinkedListSize_ = 0;
+                    linkChain(&sentinel_, otherCurrent, otherTail, count);
+                    break;
+                }
+
+                // The run of other which goes before current
+                NodeBase *runEnd = otherCurrent->next;
+                size_t count = 1;
+                while (runEnd != &other.sentinel_ && compare(valueOf(runEnd), valueOf(current))) {
+                    runEnd = runEnd->next;
+                    ++count;
+                }
+                NodeBase *runTail = runEnd->prev;
+                unlinkRange(otherCurrent, runEnd);
+                other.doubleLinkedListSize_ -= count;
+                linkChain(current, otherCurrent, runTail, count);
+                otherCurrent = runEnd;
+            }
+        };
+
+        template<class Compare>
+        void merge(DoubleLinkedList &&other, Compare compare) {
+            merge(other, compare);
+        };
+
+        /**
+         * @brief Inserts copies of the sorted elements from first to last (not include) into the sorted list
+         *        by operator<. Implementation features are described in insert_sorted_batch(first, last, compare)
+         *
+         * @param first - iterator to the first element to insert
+         * @param last - iterator to the element after the last one to insert
+         */
+        template<class InputIterator>
+        void insert_sorted_batch(InputIterator first, InputIterator last) {
+            insert_sorted_batch(first, last, std::less<T>());
+        };
+
+        /**
+         * @brief Inserts copies of the sorted elements from first to last (not include) into the sorted list
+         *        The new nodes are built into a detached chain, the node cache is used, and the chain
+         *        is merged into the list in one pass, O(n + m) instead of a walk per element
+         *
+         * @param first - iterator to the first element to insert, the range is sorted by compare
+         * @param last - iterator to the element after the last one to insert
+         * @param compare - strict weak ordering of the elements, the current list is sorted by it
+         */
+        template<class InputIterator, class Compare>
+        void insert_sorted_batch(InputIterator first, InputIterator last, Compare compare) {
+            DoubleLinkedList batch(get_allocator());
+            NodeBase *head = nullptr;
+            NodeBase *tail = nullptr;
+            size_t count = 0;
+            try {
+                for (; first != last; ++first) {
+                    appendToChain(head, tail, createNode(*first));
+                    ++count;
+                }
+            } catch (...) {
+                destroyChain(head, tail);
+                throw;
+            }
+            if (count == 0) {
+                return;
+            }
+            batch.linkChain(&batch.sentinel_, head, tail, count);
+            merge(batch, compare);
+        };
     };
 
+    /**
+     * @brief Exchanges the contents of two lists, it is found by argument-dependent lookup
+     *
+     * @param left - first list to exchange
+     * @param right - second list to exchange
+     */
+    template<class T, class Allocator, class NodeLayout>
+    void swap(DoubleLinkedList<T, Allocator, NodeLayout> &left,
+              DoubleLinkedList<T, Allocator, NodeLayout> &right) noexcept {
+        left.swap(right);
+    }
+
     /**
      * @brief Compares two lists element by element for the inequality
      *
@@ -637,26 +2559,10 @@ namespace LinkedLists {
      * @return true, if the lists are not equal
      *         false, if equal
      */
-    template<class T>
-    bool operator!=(const DoubleLinkedList<T> &left, const DoubleLinkedList<T> &right) {
-        if (&left == &right) {
-            return false;
-        }
-
-        if (left.size() != right.size()) {
-            return true;
-        }
-
-        auto curItLeft = left.begin();
-        auto curItRight = right.begin();
-        while (curItLeft != left.end() && curItRight != right.end()) {
-            if (*curItLeft != *curItRight) {
-                return true;
-            }
-            curItLeft++;
-            curItRight++;
-        }
-        return false;
+    template<class T, class Allocator, class NodeLayout>
+    bool operator!=(const DoubleLinkedList<T, Allocator, NodeLayout> &left,
+                    const DoubleLinkedList<T, Allocator, NodeLayout> &right) {
+        return !left.equals(right);
     }
 
     /**
@@ -667,8 +2573,9 @@ namespace LinkedLists {
      * @return true, if the lists are equal
      *         false, if not
      */
-    template<class T>
-    bool operator==(const DoubleLinkedList<T> &left, const DoubleLinkedList<T> &right) {
+    template<class T, class Allocator, class NodeLayout>
+    bool operator==(const DoubleLinkedList<T, Allocator, NodeLayout> &left,
+                    const DoubleLinkedList<T, Allocator, NodeLayout> &right) {
         return !(left != right);
     }
 
@@ -680,17 +2587,16 @@ namespace LinkedLists {
      * @param doubleLinkedList - the list for print to the out stream
      * @return output stream after using
      */
-    template<class T>
-    std::ostream &operator<<(std::ostream &out, const DoubleLinkedList<T> &doubleLinkedList) {
+    template<class T, class Allocator, class NodeLayout>
+    std::ostream &operator<<(std::ostream &out, const DoubleLinkedList<T, Allocator, NodeLayout> &doubleLinkedList) {
         out << "[";
-        auto currentIterator = doubleLinkedList.cbegin();
-        while (currentIterator != doubleLinkedList.cend()) {
-            out << *currentIterator;
-            if (currentIterator != --doubleLinkedList.cend()) {
+        size_t printed = 0;
+        doubleLinkedList.for_each_prefetched([&out, &printed, &doubleLinkedList](const T &value) {
+            out << value;
+            if (++printed != doubleLinkedList.size()) {
                 out << " <---> ";
             }
-            ++currentIterator;
-        }
+        });
         out << "]" << std::endl;
         return out;
     }
@@ -703,12 +2609,74 @@ namespace LinkedLists {
      * @param right - second list to join
      * @return merged list
      */
-    template<class T>
-    LinkedLists::DoubleLinkedList<T> operator+(const LinkedLists::DoubleLinkedList<T> &left,
-                                               const LinkedLists::DoubleLinkedList<T> &right) {
-        LinkedLists::DoubleLinkedList<T> list(left);
+    template<class T, class Allocator, class NodeLayout>
+    LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> operator+(
+            const LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &left,
+            const LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &right) {
+        LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> list(left);
         list += right;
         return list;
     }
 
+    /**
+     * @brief Merges two lists into one, the nodes of the temporary left list are reused
+     *
+     * @param left - first list to join, its elements are moved to the result
+     * @param right - second list to join
+     * @return merged list
+     */
+    template<class T, class Allocator, class NodeLayout>
+    LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> operator+(
+            LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &&left,
+            const LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &right) {
+        left += right;
+        return std::move(left);
+    }
+
+    /**
+     * @brief Merges two lists into one, the nodes of the temporary right list are relinked
+     *
+     * @param left - first list to join
+     * @param right - second list to join, its elements are moved to the result
+     * @return merged list
+     */
+    template<class T, class Allocator, class NodeLayout>
+    LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> operator+(
+            const LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &left,
+            LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &&right) {
+        LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> list(left);
+        list += std::move(right);
+        return list;
+    }
+
+    /**
+     * @brief Merges two temporary lists into one by relinking their nodes
+     *
+     * @param left - first list to join, its elements are moved to the result
+     * @param right - second list to join, its elements are moved to the result
+     * @return merged list
+     */
+    template<class T, class Allocator, class NodeLayout>
+    LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> operator+(
+            LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &&left,
+            LinkedLists::DoubleLinkedList<T, Allocator, NodeLayout> &&right) {
+        left += std::move(right);
+        return std::move(left);
+    }
+
+
+    namespace pmr {
+
+        /**
+         * @brief List which takes all nodes from std::pmr::memory_resource
+         *        Elements which use std::pmr::polymorphic_allocator themselves
+         *        (for example std::pmr::string) are given the same resource
+         *
+         * @tparam T
+         */
+        template<class T>
+        using DoubleLinkedList = LinkedLists::DoubleLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+
+    }
+
 }
\ No newline at end of file
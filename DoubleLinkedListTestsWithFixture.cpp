@@ -1,8 +1,17 @@
 #include "DoubleLinkedList.h"
 #include "LinkedListsException.h"
+#include "NodeArena.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <functional>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <sstream>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace googleTests {
 
@@ -18,6 +27,88 @@ namespace googleTests {
     const char *OUTPUT_STRING_WITH_NON_EMPTY_LIST_ELEMENTS = "[1.101 <---> 2.202 <---> 3.303 <---> 4.404 <---> 5.505 <---> 6.606]\n";
     const char *OUTPUT_STRING_WITH_EMPTY_LIST_ELEMENTS = "[]\n";
 
+    /**
+     * @brief Stateful allocator that counts live allocated objects
+     *        Allocators are equal if they share the same counter
+     *        It propagates on copy assignment, move assignment and swap
+     */
+    template<class T>
+    struct CountingAllocator {
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        size_t *liveObjects;
+
+        explicit CountingAllocator(size_t *counter) : liveObjects(counter) {
+        }
+
+        template<class U>
+        CountingAllocator(const CountingAllocator<U> &other) : liveObjects(other.liveObjects) {
+        }
+
+        T *allocate(size_t n) {
+            *liveObjects += n;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T *pointer, size_t n) {
+            *liveObjects -= n;
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        template<class U>
+        bool operator==(const CountingAllocator<U> &other) const {
+            return liveObjects == other.liveObjects;
+        }
+
+        template<class U>
+        bool operator!=(const CountingAllocator<U> &other) const {
+            return liveObjects != other.liveObjects;
+        }
+    };
+
+    /**
+     * @brief CountingAllocator which never propagates to another list
+     */
+    template<class T>
+    struct LocalCountingAllocator : CountingAllocator<T> {
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+
+        explicit LocalCountingAllocator(size_t *counter) : CountingAllocator<T>(counter) {
+        }
+
+        template<class U>
+        LocalCountingAllocator(const LocalCountingAllocator<U> &other) : CountingAllocator<T>(other) {
+        }
+    };
+
+    /**
+     * @brief Tells whether the elements follow each other in memory with one positive stride,
+     *        which is the layout a finished compact() pass gives an arena list
+     *
+     * @param list - list with at least two elements
+     * @return true, if every element lies at the same distance after the previous one
+     */
+    template<class List>
+    bool isLaidOutInListOrder(const List &list) {
+        auto previous = list.begin();
+        auto current = ++list.begin();
+        auto stride = reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous);
+        if (stride <= 0) {
+            return false;
+        }
+        for (; current != list.end(); previous = current++) {
+            if (reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous) != stride) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     class DoubleLinkedListFixtureClassTest : public ::testing::Test {
     protected:
 
@@ -37,7 +128,8 @@ namespace googleTests {
         LinkedLists::DoubleLinkedList<double> *nonEmptyListWithDoubles;
 
     public:
-        static void fillCertainDoublesToList(LinkedLists::DoubleLinkedList<double> &list) {
+        template<class List>
+        static void fillCertainDoublesToList(List &list) {
             // look at GENERATED_DOUBLE_NUMBERS_AMOUNT
             list.push_back(FIRST_VALUE_IN_TEST_LIST);
             list.push_back(SECOND_VALUE_IN_TEST_LIST);
@@ -195,5 +287,928 @@ namespace googleTests {
         delete saveOriginalList;
     }
 
+    TEST_F(DoubleLinkedListFixtureClassTest, AllNodesGoThroughAllocator) {
+        size_t liveNodes = 0;
+        {
+            CountingAllocator<double> allocator(&liveNodes);
+            LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> list(allocator);
+            EXPECT_EQ(0, liveNodes);
+            list.push_back(FIRST_VALUE_IN_TEST_LIST);
+            list.push_front(SECOND_VALUE_IN_TEST_LIST);
+            EXPECT_EQ(2, liveNodes);
+            list.pop_back();
+            EXPECT_EQ(1, liveNodes);
+
+            LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> copiedList(list);
+            EXPECT_EQ(true, copiedList.get_allocator() == allocator);
+            EXPECT_EQ(2, liveNodes);
+        }
+        EXPECT_EQ(0, liveNodes);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, AllocatorPropagatesOnMoveAndSwap) {
+        size_t firstLiveNodes = 0;
+        size_t secondLiveNodes = 0;
+        {
+            LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> firstList(
+                    (CountingAllocator<double>(&firstLiveNodes)));
+            LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> secondList(
+                    (CountingAllocator<double>(&secondLiveNodes)));
+            firstList.push_back(FIRST_VALUE_IN_TEST_LIST);
+            secondList.push_back(SECOND_VALUE_IN_TEST_LIST);
+            secondList.push_back(THIRD_VALUE_IN_TEST_LIST);
+
+            firstList.swap(secondList);
+            EXPECT_EQ(2, firstList.size());
+            EXPECT_EQ(true, firstList.get_allocator() == CountingAllocator<double>(&secondLiveNodes));
+
+            secondList = std::move(firstList);
+            EXPECT_EQ(true, secondList.get_allocator() == CountingAllocator<double>(&secondLiveNodes));
+            EXPECT_EQ(THIRD_VALUE_IN_TEST_LIST, secondList.back());
+        }
+        EXPECT_EQ(0, firstLiveNodes);
+        EXPECT_EQ(0, secondLiveNodes);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, ErasedNodesAreReused) {
+        size_t liveNodes = 0;
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> list((CountingAllocator<double>(&liveNodes)));
+        list.set_node_cache_limit(2);
+        list.reserve(3);
+        EXPECT_EQ(3, list.cached_nodes());
+        EXPECT_EQ(3, list.node_cache_limit());
+        EXPECT_EQ(3, liveNodes);
+
+        for (size_t i = 0; i < GENERATED_DOUBLE_NUMBERS_AMOUNT; i++) {
+            list.push_back(FIRST_VALUE_IN_TEST_LIST);
+            list.push_back(SECOND_VALUE_IN_TEST_LIST);
+            list.pop_front();
+            list.pop_front();
+        }
+        EXPECT_EQ(true, list.empty());
+        EXPECT_EQ(3, liveNodes);
+
+        list.set_node_cache_limit(1);
+        EXPECT_EQ(1, list.cached_nodes());
+        list.shrink_to_fit();
+        EXPECT_EQ(0, list.cached_nodes());
+        EXPECT_EQ(0, liveNodes);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, ArenaBoundList) {
+        LinkedLists::NodeArena arena(1024);
+        {
+            LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+            for (size_t i = 0; i < 1000; i++) {
+                fillCertainDoublesToList(list);
+            }
+            EXPECT_EQ(1000 * GENERATED_DOUBLE_NUMBERS_AMOUNT, list.size());
+            EXPECT_LT(1, arena.slabs_count());
+
+            LinkedLists::ArenaDoubleLinkedList<double> copiedList(list);
+            EXPECT_EQ(true, copiedList == list);
+
+            list.clear();
+            EXPECT_EQ(true, list.empty());
+            EXPECT_EQ(true, list.begin() == list.end());
+            fillCertainDoublesToList(list);
+            EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, list.size());
+            EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, list.front());
+            EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST, list.back());
+        }
+        arena.release();
+        EXPECT_EQ(0, arena.slabs_count());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, PmrListTakesMemoryFromResource) {
+        // Null upstream makes any allocation outside the buffer throw std::bad_alloc
+        alignas(std::max_align_t) char buffer[16 * 1024];
+        std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+        LinkedLists::pmr::DoubleLinkedList<std::pmr::string> list(&resource);
+        const std::string longString(100, 'x');
+        for (size_t i = 0; i < GENERATED_DOUBLE_NUMBERS_AMOUNT; i++) {
+            list.push_back(std::pmr::string(longString, &resource));
+            list.push_front(std::pmr::string(longString, &resource));
+        }
+        EXPECT_EQ(2 * GENERATED_DOUBLE_NUMBERS_AMOUNT, list.size());
+        EXPECT_EQ(&resource, list.front().get_allocator().resource());
+        EXPECT_EQ(&resource, list.back().get_allocator().resource());
+
+        std::pmr::vector<LinkedLists::pmr::DoubleLinkedList<std::pmr::string>> lists(&resource);
+        lists.reserve(2);
+        lists.push_back(list);
+        lists.emplace_back();
+        EXPECT_EQ(&resource, lists[0].get_allocator().resource());
+        EXPECT_EQ(&resource, lists[1].get_allocator().resource());
+        EXPECT_EQ(&resource, lists[0].back().get_allocator().resource());
+        EXPECT_EQ(true, lists[0] == list);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, EmptyListAllocatesNothing) {
+        size_t liveNodes = 0;
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> list((CountingAllocator<double>(&liveNodes)));
+        EXPECT_EQ(0, liveNodes);
+        EXPECT_EQ(true, list.begin() == list.end());
+
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> movedList(std::move(list));
+        EXPECT_EQ(0, liveNodes);
+        EXPECT_EQ(true, noexcept(LinkedLists::DoubleLinkedList<double>()));
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, ElementsWithoutDefaultConstructor) {
+        struct Point {
+            explicit Point(int value) : x(value) {
+            }
+
+            int x;
+        };
+
+        LinkedLists::DoubleLinkedList<Point> list;
+        list.push_back(Point(1));
+        list.push_front(Point(0));
+        EXPECT_EQ(0, list.front().x);
+        EXPECT_EQ(1, list.back().x);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, EmplaceMoveOnlyElements) {
+        LinkedLists::DoubleLinkedList<std::unique_ptr<double>> list;
+        list.emplace_back(new double(SECOND_VALUE_IN_TEST_LIST));
+        list.emplace_front(new double(FIRST_VALUE_IN_TEST_LIST));
+        list.push_back(std::make_unique<double>(FOURTH_VALUE_IN_TEST_LIST));
+        list.insert(--list.end(), std::make_unique<double>(THIRD_VALUE_IN_TEST_LIST));
+        auto fifth = list.emplace(list.end(), std::make_unique<double>(FIFTH_VALUE_IN_TEST_LIST));
+
+        EXPECT_EQ(5, list.size());
+        EXPECT_EQ(FIFTH_VALUE_IN_TEST_LIST, **fifth);
+        double expectedValues[] = {FIRST_VALUE_IN_TEST_LIST, SECOND_VALUE_IN_TEST_LIST, THIRD_VALUE_IN_TEST_LIST,
+                                   FOURTH_VALUE_IN_TEST_LIST, FIFTH_VALUE_IN_TEST_LIST};
+        size_t index = 0;
+        for (auto &pointer : list) {
+            EXPECT_EQ(expectedValues[index++], *pointer);
+        }
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, EmplaceConstructsInPlace) {
+        LinkedLists::DoubleLinkedList<std::pair<std::string, double>> list;
+        auto &element = list.emplace_back("first", FIRST_VALUE_IN_TEST_LIST);
+        EXPECT_EQ("first", element.first);
+        EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, list.front().second);
+
+        std::string movedString(64, 'x');
+        const char *movedBuffer = movedString.data();
+        LinkedLists::DoubleLinkedList<std::string> strings;
+        strings.push_back(std::move(movedString));
+        EXPECT_EQ(movedBuffer, strings.back().data());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, CopyIntoArenaIsContiguous) {
+        LinkedLists::NodeArena arena(256);
+        LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+        for (size_t i = 0; i < 100; i++) {
+            fillCertainDoublesToList(list);
+        }
+
+        LinkedLists::ArenaDoubleLinkedList<double> copiedList(list);
+        EXPECT_EQ(true, copiedList == list);
+        auto previous = copiedList.begin();
+        auto current = ++copiedList.begin();
+        auto stride = reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous);
+        EXPECT_LT(0, stride);
+        while (current != copiedList.end()) {
+            EXPECT_EQ(stride, reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous));
+            previous = current++;
+        }
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, CopyOfItself) {
+        *nonEmptyListWithDoubles += *nonEmptyListWithDoubles;
+        EXPECT_EQ(2 * GENERATED_DOUBLE_NUMBERS_AMOUNT, nonEmptyListWithDoubles->size());
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->back());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, CopyAssignmentReusesNodes) {
+        size_t liveNodes = 0;
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> source((CountingAllocator<double>(&liveNodes)));
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> replica((CountingAllocator<double>(&liveNodes)));
+        fillCertainDoublesToList(source);
+        replica.assign(GENERATED_DOUBLE_NUMBERS_AMOUNT - 1, FIRST_VALUE_IN_TEST_LIST);
+        EXPECT_EQ(2 * GENERATED_DOUBLE_NUMBERS_AMOUNT - 1, liveNodes);
+
+        const double *firstElementAddress = &replica.front();
+        replica = source;
+        EXPECT_EQ(true, replica == source);
+        EXPECT_EQ(firstElementAddress, &replica.front());
+        EXPECT_EQ(2 * GENERATED_DOUBLE_NUMBERS_AMOUNT, liveNodes);
+
+        source.pop_back();
+        source.pop_back();
+        replica = source;
+        EXPECT_EQ(true, replica == source);
+        EXPECT_EQ(firstElementAddress, &replica.front());
+        EXPECT_EQ(2 * GENERATED_DOUBLE_NUMBERS_AMOUNT - 4, liveNodes);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, AssignMethods) {
+        std::vector<double> values = {FIRST_VALUE_IN_TEST_LIST, SECOND_VALUE_IN_TEST_LIST, THIRD_VALUE_IN_TEST_LIST,
+                                      FOURTH_VALUE_IN_TEST_LIST, FIFTH_VALUE_IN_TEST_LIST, SIXTH_VALUE_IN_TEST_LIST};
+        emptyListWithDoubles->assign(values.begin(), values.end());
+        EXPECT_EQ(true, *emptyListWithDoubles == *nonEmptyListWithDoubles);
+
+        emptyListWithDoubles->assign(values.begin(), values.begin() + 2);
+        EXPECT_EQ(2, emptyListWithDoubles->size());
+        EXPECT_EQ(SECOND_VALUE_IN_TEST_LIST, emptyListWithDoubles->back());
+
+        emptyListWithDoubles->assign(4, THIRD_VALUE_IN_TEST_LIST);
+        EXPECT_EQ(4, emptyListWithDoubles->size());
+        EXPECT_EQ(4, emptyListWithDoubles->remove(THIRD_VALUE_IN_TEST_LIST));
+
+        LinkedLists::DoubleLinkedList<int> integers;
+        integers.assign(3, 7);
+        EXPECT_EQ(3, integers.size());
+        EXPECT_EQ(7, integers.back());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, MovesAndSwapDoNotAllocate) {
+        size_t liveNodes = 0;
+        using CountingList = LinkedLists::DoubleLinkedList<double, CountingAllocator<double>>;
+        CountingList list((CountingAllocator<double>(&liveNodes)));
+        fillCertainDoublesToList(list);
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, liveNodes);
+
+        CountingList movedList(std::move(list));
+        CountingList assignedList((CountingAllocator<double>(&liveNodes)));
+        assignedList = std::move(movedList);
+        swap(assignedList, list);
+        std::swap(list, movedList);
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, liveNodes);
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, movedList.size());
+        EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, movedList.front());
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST, movedList.back());
+        EXPECT_EQ(true, list.empty());
+        EXPECT_EQ(true, assignedList.empty());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, MovedFromListIsUsable) {
+        LinkedLists::DoubleLinkedList<double> newListWithDoubles = std::move(*nonEmptyListWithDoubles);
+        EXPECT_EQ(true, nonEmptyListWithDoubles->empty());
+        EXPECT_EQ(true, nonEmptyListWithDoubles->begin() == nonEmptyListWithDoubles->end());
+        fillCertainDoublesToList(*nonEmptyListWithDoubles);
+        EXPECT_EQ(true, newListWithDoubles == *nonEmptyListWithDoubles);
+
+        newListWithDoubles = std::move(*nonEmptyListWithDoubles);
+        nonEmptyListWithDoubles->push_back(FIRST_VALUE_IN_TEST_LIST);
+        EXPECT_EQ(1, nonEmptyListWithDoubles->size());
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, newListWithDoubles.size());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, MoveAssignmentBetweenUnequalAllocators) {
+        size_t firstLiveNodes = 0;
+        size_t secondLiveNodes = 0;
+        using LocalList = LinkedLists::DoubleLinkedList<std::unique_ptr<double>, LocalCountingAllocator<std::unique_ptr<double>>>;
+        LocalList firstList((LocalCountingAllocator<std::unique_ptr<double>>(&firstLiveNodes)));
+        LocalList secondList((LocalCountingAllocator<std::unique_ptr<double>>(&secondLiveNodes)));
+        firstList.push_back(std::make_unique<double>(FIRST_VALUE_IN_TEST_LIST));
+        firstList.push_back(std::make_unique<double>(SECOND_VALUE_IN_TEST_LIST));
+        secondList.push_back(std::make_unique<double>(THIRD_VALUE_IN_TEST_LIST));
+
+        secondList = std::move(firstList);
+        EXPECT_EQ(true, firstList.empty());
+        EXPECT_EQ(0, firstLiveNodes);
+        EXPECT_EQ(2, secondLiveNodes);
+        EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, *secondList.front());
+        EXPECT_EQ(SECOND_VALUE_IN_TEST_LIST, *secondList.back());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, SpliceMethods) {
+        auto *saveOriginalList = new LinkedLists::DoubleLinkedList<double>(*nonEmptyListWithDoubles);
+        const double *firstElementAddress = &nonEmptyListWithDoubles->front();
+
+        emptyListWithDoubles->splice(emptyListWithDoubles->end(), *nonEmptyListWithDoubles);
+        EXPECT_EQ(true, nonEmptyListWithDoubles->empty());
+        EXPECT_EQ(true, *emptyListWithDoubles == *saveOriginalList);
+        EXPECT_EQ(firstElementAddress, &emptyListWithDoubles->front());
+
+        nonEmptyListWithDoubles->splice(nonEmptyListWithDoubles->end(), *emptyListWithDoubles,
+                                        emptyListWithDoubles->begin());
+        EXPECT_EQ(1, nonEmptyListWithDoubles->size());
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT - 1, emptyListWithDoubles->size());
+
+        nonEmptyListWithDoubles->splice(nonEmptyListWithDoubles->end(), *emptyListWithDoubles,
+                                        emptyListWithDoubles->begin(), emptyListWithDoubles->end());
+        EXPECT_EQ(true, emptyListWithDoubles->empty());
+        EXPECT_EQ(true, *nonEmptyListWithDoubles == *saveOriginalList);
+
+        // Move the last two elements to the front of the same list
+        nonEmptyListWithDoubles->splice(nonEmptyListWithDoubles->begin(), *nonEmptyListWithDoubles,
+                                        --(--nonEmptyListWithDoubles->end()), nonEmptyListWithDoubles->end());
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, nonEmptyListWithDoubles->size());
+        EXPECT_EQ(FIFTH_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->front());
+        EXPECT_EQ(FOURTH_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->back());
+
+        EXPECT_THROW(emptyListWithDoubles->splice(emptyListWithDoubles->end(), *nonEmptyListWithDoubles,
+                                                  nonEmptyListWithDoubles->end()), LinkedLists::LinkedListsException);
+        delete saveOriginalList;
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, SpliceBetweenUnequalAllocators) {
+        size_t firstLiveNodes = 0;
+        size_t secondLiveNodes = 0;
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> firstList(
+                (CountingAllocator<double>(&firstLiveNodes)));
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> secondList(
+                (CountingAllocator<double>(&secondLiveNodes)));
+        fillCertainDoublesToList(firstList);
+        EXPECT_THROW(secondList.splice(secondList.end(), firstList), LinkedLists::LinkedListsException);
+
+        secondList += std::move(firstList);
+        EXPECT_EQ(true, firstList.empty());
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, secondList.size());
+        EXPECT_EQ(0, firstLiveNodes);
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, secondLiveNodes);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, MergesTemporaryLists) {
+        size_t liveNodes = 0;
+        using CountingList = LinkedLists::DoubleLinkedList<double, CountingAllocator<double>>;
+        CountingList firstList((CountingAllocator<double>(&liveNodes)));
+        CountingList secondList((CountingAllocator<double>(&liveNodes)));
+        fillCertainDoublesToList(firstList);
+        fillCertainDoublesToList(secondList);
+
+        CountingList mergedList = std::move(firstList) + std::move(secondList);
+        EXPECT_EQ(2 * GENERATED_DOUBLE_NUMBERS_AMOUNT, mergedList.size());
+        EXPECT_EQ(2 * GENERATED_DOUBLE_NUMBERS_AMOUNT, liveNodes);
+
+        CountingList result = mergedList + CountingList(mergedList);
+        EXPECT_EQ(4 * GENERATED_DOUBLE_NUMBERS_AMOUNT, result.size());
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST, result.back());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, SplitNodeLayout) {
+        struct Record {
+            double key;
+            char payload[200];
+        };
+
+        size_t liveObjects = 0;
+        using SplitList = LinkedLists::DoubleLinkedList<Record, CountingAllocator<Record>, LinkedLists::SplitNodeLayout>;
+        {
+            SplitList list((CountingAllocator<Record>(&liveObjects)));
+            list.push_back(Record{FIRST_VALUE_IN_TEST_LIST, {}});
+            list.emplace_back(Record{SECOND_VALUE_IN_TEST_LIST, {}});
+            list.push_front(Record{THIRD_VALUE_IN_TEST_LIST, {}});
+            // A link node and an out of line record per element
+            EXPECT_EQ(6, liveObjects);
+            EXPECT_EQ(THIRD_VALUE_IN_TEST_LIST, list.front().key);
+            EXPECT_EQ(SECOND_VALUE_IN_TEST_LIST, list.back().key);
+
+            SplitList copiedList(list);
+            copiedList.pop_front();
+            EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, copiedList.begin()->key);
+            EXPECT_EQ(10, liveObjects);
+        }
+        EXPECT_EQ(0, liveObjects);
+
+        LinkedLists::DoubleLinkedList<double, std::allocator<double>, LinkedLists::SplitNodeLayout> doubles;
+        fillCertainDoublesToList(doubles);
+        doubles.remove(THIRD_VALUE_IN_TEST_LIST);
+        std::stringstream listOutputStream;
+        listOutputStream << doubles;
+        EXPECT_EQ("[1.101 <---> 2.202 <---> 4.404 <---> 5.505 <---> 6.606]\n", listOutputStream.str());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, CompactRelocatesNodesInListOrder) {
+        LinkedLists::NodeArena arena;
+        LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+        std::vector<double> reference;
+        // Pushing to the front gives descending node addresses
+        for (int i = 0; i < 60; i++) {
+            list.push_front(i);
+            reference.insert(reference.begin(), i);
+        }
+
+        size_t calls = 0;
+        while (!list.compact(7)) {
+            if (++calls == 2) {
+                // The next call continues from the erased node, it has to move to the following one
+                list.erase(list.begin() + 14);
+                reference.erase(reference.begin() + 14);
+            }
+        }
+        EXPECT_EQ(8, calls);
+        EXPECT_EQ(true, std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+
+        auto previous = list.begin();
+        auto current = ++list.begin();
+        auto stride = reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous);
+        EXPECT_LT(0, stride);
+        while (current != list.end()) {
+            EXPECT_EQ(stride, reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous));
+            previous = current++;
+        }
+        EXPECT_EQ(true, list.compact());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, CompactKeepsImmovableElementsInPlace) {
+        struct Immovable {
+            int value;
+
+            explicit Immovable(int value) : value(value) {
+            }
+
+            Immovable(const Immovable &other) = delete;
+        };
+
+        LinkedLists::DoubleLinkedList<Immovable, std::allocator<Immovable>, LinkedLists::SplitNodeLayout> list;
+        for (int i = 0; i < 50; i++) {
+            if (i % 3 == 0) {
+                list.emplace_back(i);
+            } else {
+                list.emplace(list.begin() + (i % 7), i);
+            }
+        }
+        std::vector<const Immovable *> addresses;
+        for (const Immovable &element : list) {
+            addresses.push_back(&element);
+        }
+
+        EXPECT_EQ(false, list.compact(20));
+        EXPECT_EQ(false, list.compact(0));
+        EXPECT_EQ(true, list.compact());
+        auto address = addresses.begin();
+        for (const Immovable &element : list) {
+            EXPECT_EQ(*address++, &element);
+        }
+        EXPECT_EQ(50, list.size());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, ForEachPrefetched) {
+        EXPECT_EQ(0, nonEmptyListWithDoubles->prefetch_distance());
+        for (size_t distance : {0, 1, 3, 100}) {
+            nonEmptyListWithDoubles->set_prefetch_distance(distance);
+            std::vector<double> visited;
+            nonEmptyListWithDoubles->for_each_prefetched([&visited](double &value) {
+                visited.push_back(value);
+                value += 1;
+            });
+            EXPECT_EQ(true, std::equal(visited.begin(), visited.end(),
+                                       nonEmptyListWithDoubles->begin(), nonEmptyListWithDoubles->end(),
+                                       [](double left, double right) { return left + 1 == right; }));
+
+            LinkedLists::DoubleLinkedList<double> copiedList(*nonEmptyListWithDoubles);
+            copiedList.set_prefetch_distance(distance);
+            EXPECT_EQ(true, copiedList == *nonEmptyListWithDoubles);
+            double lastValue = copiedList.back();
+            EXPECT_EQ(1, copiedList.remove(lastValue));
+            EXPECT_EQ(true, copiedList != *nonEmptyListWithDoubles);
+        }
+
+        const LinkedLists::DoubleLinkedList<double> &constList = *emptyListWithDoubles;
+        size_t calls = 0;
+        constList.for_each_prefetched([&calls](const double &) {
+            ++calls;
+        });
+        EXPECT_EQ(0, calls);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, SortIsStableAndKeepsNodes) {
+        std::mt19937 generator(7);
+        LinkedLists::DoubleLinkedList<std::pair<int, int>> list;
+        std::vector<std::pair<int, int>> reference;
+        for (int i = 0; i < 1000; i++) {
+            std::pair<int, int> element(static_cast<int>(generator() % 50), i);
+            list.push_back(element);
+            reference.push_back(element);
+        }
+        auto firstElement = list.begin();
+        const std::pair<int, int> *firstAddress = &*firstElement;
+
+        auto byKey = [](const std::pair<int, int> &left, const std::pair<int, int> &right) {
+            return left.first < right.first;
+        };
+        list.sort(byKey);
+        std::stable_sort(reference.begin(), reference.end(), byKey);
+        EXPECT_EQ(true, std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+        // The iterator still points to the same element, now at its sorted place
+        EXPECT_EQ(firstAddress, &*firstElement);
+        EXPECT_EQ(0, firstElement->second);
+        EXPECT_EQ(reference.back(), *(--list.end()));
+
+        nonEmptyListWithDoubles->push_front(SIXTH_VALUE_IN_TEST_LIST + 1);
+        nonEmptyListWithDoubles->sort();
+        EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->front());
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST + 1, nonEmptyListWithDoubles->back());
+        nonEmptyListWithDoubles->sort(std::greater<double>());
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST + 1, nonEmptyListWithDoubles->front());
+        EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->back());
+        emptyListWithDoubles->sort();
+        EXPECT_EQ(true, emptyListWithDoubles->empty());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, SortKeepsElementsWhenCompareThrows) {
+        LinkedLists::DoubleLinkedList<int> list;
+        for (int i = 0; i < 100; i++) {
+            list.push_front(i);
+        }
+        size_t comparisons = 0;
+        EXPECT_THROW(list.sort([&comparisons](int left, int right) {
+            if (++comparisons == 150) {
+                throw LinkedLists::LinkedListsException("Comparison failed");
+            }
+            return left < right;
+        }), LinkedLists::LinkedListsException);
+
+        EXPECT_EQ(100, list.size());
+        std::vector<int> elements(list.begin(), list.end());
+        std::sort(elements.begin(), elements.end());
+        for (int i = 0; i < 100; i++) {
+            EXPECT_EQ(i, elements[i]);
+        }
+        EXPECT_EQ(elements.size(), std::distance(list.begin(), list.end()));
+        EXPECT_EQ(list.back(), *(--list.end()));
+        list.sort();
+        EXPECT_EQ(0, list.front());
+        EXPECT_EQ(99, list.back());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, MergeRelinksNodes) {
+        size_t liveNodes = 0;
+        using PairList = LinkedLists::DoubleLinkedList<std::pair<int, char>, CountingAllocator<std::pair<int, char>>>;
+        PairList list((CountingAllocator<std::pair<int, char>>(&liveNodes)));
+        PairList events((CountingAllocator<std::pair<int, char>>(&liveNodes)));
+        for (int i = 0; i < 10; i++) {
+            list.emplace_back(i * 2, 'l');
+            events.emplace_back(i * 3, 'e');
+        }
+        auto eventIterator = events.begin();
+
+        auto byTime = [](const std::pair<int, char> &left, const std::pair<int, char> &right) {
+            return left.first < right.first;
+        };
+        list.merge(std::move(events), byTime);
+        EXPECT_EQ(true, events.empty());
+        EXPECT_EQ(20, list.size());
+        EXPECT_EQ(20, liveNodes);
+        EXPECT_EQ(true, std::is_sorted(list.begin(), list.end(), byTime));
+        // The node of other is relinked, the iterator follows it to the current list
+        EXPECT_EQ('e', eventIterator->second);
+        EXPECT_EQ('l', list.front().second);
+        EXPECT_EQ('e', (++list.begin())->second);
+        EXPECT_EQ(27, list.back().first);
+
+        std::vector<std::pair<int, char>> batch = {{-1, 'b'}, {6, 'b'}, {100, 'b'}};
+        list.insert_sorted_batch(batch.begin(), batch.end(), byTime);
+        EXPECT_EQ(23, list.size());
+        EXPECT_EQ('b', list.front().second);
+        EXPECT_EQ('b', list.back().second);
+        auto sixes = std::find_if(list.begin(), list.end(), [](const std::pair<int, char> &element) {
+            return element.first == 6;
+        });
+        EXPECT_EQ('l', sixes->second);
+        EXPECT_EQ('e', (++sixes)->second);
+        EXPECT_EQ('b', (++sixes)->second);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, MergeBetweenUnequalAllocators) {
+        size_t firstLiveNodes = 0;
+        size_t secondLiveNodes = 0;
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> firstList(
+                (CountingAllocator<double>(&firstLiveNodes)));
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> secondList(
+                (CountingAllocator<double>(&secondLiveNodes)));
+        fillCertainDoublesToList(firstList);
+        secondList.push_back(0);
+        secondList.push_back(THIRD_VALUE_IN_TEST_LIST);
+        secondList.push_back(10);
+
+        secondList.merge(firstList);
+        EXPECT_EQ(true, firstList.empty());
+        EXPECT_EQ(0, firstLiveNodes);
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT + 3, secondLiveNodes);
+        EXPECT_EQ(true, std::is_sorted(secondList.begin(), secondList.end()));
+
+        std::vector<double> batch = {-1, 5, 20};
+        secondList.insert_sorted_batch(batch.begin(), batch.end());
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT + 6, secondList.size());
+        EXPECT_EQ(true, std::is_sorted(secondList.begin(), secondList.end()));
+        secondList.insert_sorted_batch(batch.end(), batch.end());
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT + 6, secondList.size());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, RemoveIfAndRemoveAny) {
+        size_t liveNodes = 0;
+        LinkedLists::DoubleLinkedList<int, CountingAllocator<int>> list((CountingAllocator<int>(&liveNodes)));
+        for (int i = 0; i < 30; i++) {
+            list.push_back(i);
+        }
+        EXPECT_EQ(10, list.remove_if([](int value) {
+            return value % 3 == 0;
+        }));
+        EXPECT_EQ(20, list.size());
+        EXPECT_EQ(20, liveNodes);
+        EXPECT_EQ(1, list.front());
+
+        // Runs at both ends and in the middle
+        EXPECT_EQ(11, list.remove_if([](int value) {
+            return value < 5 || (value > 12 && value < 20) || value > 25;
+        }));
+        EXPECT_EQ("[5 <---> 7 <---> 8 <---> 10 <---> 11 <---> 20 <---> 22 <---> 23 <---> 25]\n",
+                  (std::stringstream() << list).str());
+
+        EXPECT_EQ(4, list.remove_any(std::set<int>{5, 11, 25, 23, 100}));
+        EXPECT_EQ(1, list.remove_any(std::unordered_set<int>{10}));
+        EXPECT_EQ(4, list.size());
+        EXPECT_EQ(4, liveNodes);
+        EXPECT_EQ(1, list.remove(list.front()));
+        EXPECT_EQ(8, list.front());
+        EXPECT_EQ(3, list.remove_if([](int) {
+            return true;
+        }));
+        EXPECT_EQ(true, list.empty());
+        EXPECT_EQ(0, liveNodes);
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, UniqueMethods) {
+        LinkedLists::DoubleLinkedList<int> list;
+        for (int value : {1, 1, 1, 2, 3, 3, 1, 1, 4, 4}) {
+            list.push_back(value);
+        }
+        EXPECT_EQ(5, list.unique());
+        EXPECT_EQ("[1 <---> 2 <---> 3 <---> 1 <---> 4]\n", (std::stringstream() << list).str());
+        EXPECT_EQ(0, list.unique());
+
+        // Every element is compared with the last kept one, not with its neighbour
+        for (int value : {5, 6, 7, 8, 20, 21}) {
+            list.push_back(value);
+        }
+        EXPECT_EQ(7, list.unique([](int kept, int value) {
+            return value - kept < 3;
+        }));
+        EXPECT_EQ("[1 <---> 4 <---> 7 <---> 20]\n", (std::stringstream() << list).str());
+        EXPECT_EQ(0, emptyListWithDoubles->unique());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, ReverseAndRotate) {
+        auto third = nonEmptyListWithDoubles->begin() + 2;
+        nonEmptyListWithDoubles->reverse();
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->front());
+        EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->back());
+        EXPECT_EQ(THIRD_VALUE_IN_TEST_LIST, *third);
+        EXPECT_EQ(SECOND_VALUE_IN_TEST_LIST, *(++third));
+        EXPECT_EQ(SECOND_VALUE_IN_TEST_LIST, *(--(--nonEmptyListWithDoubles->end())));
+        nonEmptyListWithDoubles->reverse();
+        EXPECT_EQ("[1.101 <---> 2.202 <---> 3.303 <---> 4.404 <---> 5.505 <---> 6.606]\n",
+                  (std::stringstream() << *nonEmptyListWithDoubles).str());
+
+        nonEmptyListWithDoubles->rotate(nonEmptyListWithDoubles->begin() + 4);
+        EXPECT_EQ("[5.505 <---> 6.606 <---> 1.101 <---> 2.202 <---> 3.303 <---> 4.404]\n",
+                  (std::stringstream() << *nonEmptyListWithDoubles).str());
+        EXPECT_EQ(SECOND_VALUE_IN_TEST_LIST, *third);
+        EXPECT_EQ(FOURTH_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->back());
+        nonEmptyListWithDoubles->rotate(nonEmptyListWithDoubles->begin());
+        nonEmptyListWithDoubles->rotate(nonEmptyListWithDoubles->end());
+        EXPECT_EQ(FIFTH_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->front());
+        // Round robin by one element
+        for (int i = 0; i < 2; i++) {
+            nonEmptyListWithDoubles->rotate(++nonEmptyListWithDoubles->begin());
+        }
+        EXPECT_EQ(FIRST_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->front());
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->back());
+        EXPECT_EQ(GENERATED_DOUBLE_NUMBERS_AMOUNT, nonEmptyListWithDoubles->size());
+
+        emptyListWithDoubles->reverse();
+        emptyListWithDoubles->rotate(emptyListWithDoubles->begin());
+        EXPECT_EQ(true, emptyListWithDoubles->empty());
+        EXPECT_EQ(true, emptyListWithDoubles->begin() == emptyListWithDoubles->end());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, PositionalIndex) {
+        EXPECT_EQ(false, nonEmptyListWithDoubles->has_positional_index());
+        EXPECT_EQ(THIRD_VALUE_IN_TEST_LIST, nonEmptyListWithDoubles->at(2));
+        EXPECT_EQ(SIXTH_VALUE_IN_TEST_LIST, *(nonEmptyListWithDoubles->end() + (-1)));
+        EXPECT_EQ(FOURTH_VALUE_IN_TEST_LIST, *(nonEmptyListWithDoubles->end() - 3));
+        EXPECT_EQ(SECOND_VALUE_IN_TEST_LIST, *(nonEmptyListWithDoubles->cend() - 5));
+        EXPECT_THROW(nonEmptyListWithDoubles->at(GENERATED_DOUBLE_NUMBERS_AMOUNT), LinkedLists::LinkedListsException);
+        EXPECT_THROW(emptyListWithDoubles->iterator_at(1), LinkedLists::LinkedListsException);
+
+        std::mt19937 generator(42);
+        std::vector<int> reference;
+        LinkedLists::DoubleLinkedList<int> list;
+        list.set_positional_index(true);
+        EXPECT_EQ(true, list.has_positional_index());
+        EXPECT_EQ(true, list.iterator_at(0) == list.end());
+        for (int i = 0; i < 3000; i++) {
+            size_t position = generator() % (reference.size() + 1);
+            if (generator() % 3 != 0 || reference.empty()) {
+                list.insert(list.iterator_at(position), i);
+                reference.insert(reference.begin() + static_cast<std::ptrdiff_t>(position), i);
+            } else {
+                position %= reference.size();
+                list.erase(list.iterator_at(position));
+                reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(position));
+            }
+            if (i % 100 == 0) {
+                // Bulk relinking makes the index stale, it is rebuilt by the next positional call
+                list.reverse();
+                std::reverse(reference.begin(), reference.end());
+            }
+        }
+        ASSERT_EQ(reference.size(), list.size());
+        for (size_t i = 0; i < reference.size(); i++) {
+            EXPECT_EQ(reference[i], list.at(i));
+            EXPECT_EQ(i, list.index_of(list.iterator_at(i)));
+        }
+
+        list.sort();
+        std::sort(reference.begin(), reference.end());
+        const LinkedLists::DoubleLinkedList<int> &constList = list;
+        // The const calls walk the list until the stale index is rebuilt
+        EXPECT_EQ(reference[reference.size() / 2], constList.at(reference.size() / 2));
+        EXPECT_EQ(reference.size(), constList.index_of(constList.cend()));
+        EXPECT_EQ(reference[7], *list.iterator_at(list.index_of(list.end()) - reference.size() + 7));
+        EXPECT_EQ(reference.size() - 1, constList.index_of(--constList.cend()));
+
+        list.set_positional_index(false);
+        EXPECT_EQ(false, list.has_positional_index());
+        list.push_front(-1);
+        EXPECT_EQ(-1, list.at(0));
+        EXPECT_EQ(reference.back(), list.at(reference.size()));
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, FingerOfPositionalAccess) {
+        LinkedLists::DoubleLinkedList<int> list;
+        std::vector<int> reference;
+        for (int i = 0; i < 1000; i++) {
+            list.push_back(i);
+            reference.push_back(i);
+        }
+        // Ascending scan which erases and inserts behind the finger
+        for (size_t i = 0; i < list.size(); i++) {
+            EXPECT_EQ(reference[i], list.at(i));
+            if (reference[i] % 3 == 0) {
+                list.erase(list.iterator_at(i));
+                reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(i));
+            } else if (reference[i] % 7 == 0) {
+                list.insert(list.iterator_at(i), -reference[i]);
+                reference.insert(reference.begin() + static_cast<std::ptrdiff_t>(i), -reference[i]);
+                ++i;
+            }
+            if (i % 50 == 0) {
+                list.push_back(static_cast<int>(i));
+                reference.push_back(static_cast<int>(i));
+            }
+        }
+        ASSERT_EQ(reference.size(), list.size());
+        // Descending scan
+        for (size_t i = reference.size(); i-- > 0;) {
+            EXPECT_EQ(reference[i], list.at(i));
+            EXPECT_EQ(i, list.index_of(list.iterator_at(i)));
+        }
+
+        // The finger does not outlive the nodes which left the list
+        list.at(500);
+        LinkedLists::DoubleLinkedList<int> other;
+        other.splice(other.end(), list, list.iterator_at(100), list.end());
+        EXPECT_EQ(100, list.size());
+        EXPECT_EQ(reference[99], list.at(99));
+        EXPECT_EQ(reference[500], other.at(400));
+        list.clear();
+        list.push_back(1);
+        EXPECT_EQ(1, list.at(0));
+        other.pop_front();
+        other.reverse();
+        EXPECT_EQ(reference[101], other.at(other.size() - 1));
+        EXPECT_EQ(reference.back(), *other.iterator_at(0));
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, ReverseAndRotateRestartCompaction) {
+        LinkedLists::NodeArena arena;
+        LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+        for (int i = 0; i < 30; i++) {
+            list.push_front(i);
+        }
+        for (bool rotate : {false, true}) {
+            EXPECT_EQ(false, list.compact(10));
+            if (rotate) {
+                list.rotate(list.begin() + 5);
+            } else {
+                list.reverse();
+            }
+            // The interrupted pass starts over, every node is relocated once in the new order
+            while (!list.compact(7)) {
+            }
+            auto previous = list.begin();
+            auto current = ++list.begin();
+            auto stride = reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous);
+            EXPECT_LT(0, stride);
+            while (current != list.end()) {
+                EXPECT_EQ(stride, reinterpret_cast<const char *>(&*current) - reinterpret_cast<const char *>(&*previous));
+                previous = current++;
+            }
+        }
+        EXPECT_EQ(5, list.front());
+        EXPECT_EQ(4, list.back());
+        EXPECT_EQ(30, list.size());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, CompactGrowsBulkReleasedArena) {
+        LinkedLists::NodeArena arena(1024);
+        LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+        for (int i = 0; i < 200; i++) {
+            list.push_front(i);
+        }
+        size_t builtSlabs = arena.slabs_count();
+
+        // The old nodes stay in the arena, every pass takes memory for the whole list again
+        EXPECT_EQ(true, list.compact());
+        size_t firstPassSlabs = arena.slabs_count();
+        EXPECT_LT(builtSlabs, firstPassSlabs);
+        EXPECT_EQ(true, list.compact());
+        EXPECT_LT(firstPassSlabs, arena.slabs_count());
+
+        LinkedLists::NodeArena freshArena(1024);
+        LinkedLists::ArenaDoubleLinkedList<double> copy(list, LinkedLists::ArenaAllocator<double>(freshArena));
+        list.clear();
+        arena.release();
+        EXPECT_LE(freshArena.slabs_count(), builtSlabs);
+        EXPECT_EQ(200, copy.size());
+        EXPECT_EQ(199, copy.front());
+        EXPECT_EQ(0, copy.back());
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, SortRestartsCompaction) {
+        LinkedLists::NodeArena arena;
+        LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+        std::vector<double> reference;
+        for (int i = 0; i < 40; i++) {
+            list.push_back((i * 17) % 40);
+            reference.push_back((i * 17) % 40);
+        }
+        EXPECT_EQ(false, list.compact(10));
+        list.sort();
+        std::sort(reference.begin(), reference.end());
+        // The new pass relocates every node once, in the sorted order
+        while (!list.compact(7)) {
+        }
+        EXPECT_EQ(true, std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+        EXPECT_EQ(true, isLaidOutInListOrder(list));
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, MergeRestartsCompaction) {
+        LinkedLists::NodeArena arena;
+        LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+        LinkedLists::ArenaDoubleLinkedList<double> otherList(arena);
+        for (int i = 0; i < 30; i++) {
+            list.push_back(2 * i);
+            otherList.push_back(2 * i + 1);
+        }
+        EXPECT_EQ(false, list.compact(20));
+        EXPECT_EQ(false, otherList.compact(5));
+        list.merge(otherList);
+        // The odd numbers linked in before the old cursor are relocated as well
+        while (!list.compact(7)) {
+        }
+        EXPECT_EQ(true, otherList.compact());
+        EXPECT_EQ(60, list.size());
+        EXPECT_EQ(true, std::is_sorted(list.begin(), list.end()));
+        EXPECT_EQ(true, isLaidOutInListOrder(list));
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, SpliceWithinListRestartsCompaction) {
+        LinkedLists::NodeArena arena;
+        LinkedLists::ArenaDoubleLinkedList<double> list(arena);
+        for (int i = 0; i < 40; i++) {
+            list.push_front(i);
+        }
+        EXPECT_EQ(false, list.compact(10));
+        // The last 20 elements move in front of the relocated ones
+        list.splice(list.begin(), list, list.begin() + 20, list.end());
+        while (!list.compact(7)) {
+        }
+        EXPECT_EQ(19, list.front());
+        EXPECT_EQ(20, list.back());
+        EXPECT_EQ(40, list.size());
+        EXPECT_EQ(true, isLaidOutInListOrder(list));
+    }
+
+    TEST_F(DoubleLinkedListFixtureClassTest, CompactDoesNotCacheOldNodes) {
+        size_t liveNodes = 0;
+        LinkedLists::DoubleLinkedList<double, CountingAllocator<double>> list{CountingAllocator<double>(&liveNodes)};
+        list.set_node_cache_limit(100);
+        for (int i = 0; i < 50; i++) {
+            list.push_front(i);
+        }
+        EXPECT_EQ(true, list.compact());
+        // The scattered nodes are returned, the next insertions take fresh memory
+        EXPECT_EQ(0, list.cached_nodes());
+        EXPECT_EQ(50, liveNodes);
+        EXPECT_EQ(false, list.compact(20));
+        EXPECT_EQ(0, list.cached_nodes());
+        EXPECT_EQ(50, liveNodes);
+        list.clear();
+        EXPECT_EQ(50, list.cached_nodes());
+    }
+
 
 }
\ No newline at end of file
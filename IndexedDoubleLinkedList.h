@@ -0,0 +1,1025 @@
+#pragma once
+
+#include "LinkedListsException.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace LinkedLists {
+
+    /**
+     * @class IndexedDoubleLinkedList
+     *
+     * @brief Implements a template doubly linked list whose nodes live in one contiguous pool
+     *        and are linked by 32-bit slot indices instead of pointers
+     *        The links take 8 bytes per node instead of 16 on 64-bit builds, neighbouring
+     *        insertions get neighbouring slots, and erased slots are reused through
+     *        a free-index list threaded through their next links
+     *
+     *        When the pool is full it is reallocated twice as large, so references and
+     *        pointers to the elements are invalidated by insertions, but the iterators
+     *        keep working: they hold the list and the slot index. Move and swap
+     *        invalidate the iterators, since the elements change their owner
+     *
+     * @author Andrey Valitov
+     *
+     * @version 1.0
+     *
+     * @tparam T
+     * @tparam Allocator - allocator of T, it is rebound to the slot type
+     */
+    template<class T, class Allocator = std::allocator<T>>
+    class IndexedDoubleLinkedList {
+    private:
+
+        using Index = std::uint32_t;
+
+        // Marks the absence of a slot, it stands for the sentinel in the links
+        static constexpr Index NIL = std::numeric_limits<Index>::max();
+
+        static constexpr Index MINIMAL_POOL_CAPACITY = 8;
+
+        struct Slot {
+            Index prev;
+            Index next;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T *value() {
+                return std::launder(reinterpret_cast<T *>(storage));
+            };
+
+            const T *value() const {
+                return std::launder(reinterpret_cast<const T *>(storage));
+            };
+        };
+
+        using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+        using SlotAllocatorTraits = std::allocator_traits<SlotAllocator>;
+
+        Slot *slots_ = nullptr;
+
+        // Number of slots in the pool
+        Index capacity_ = 0;
+
+        // Slots from used_ to capacity_ have never been handed out
+        Index used_ = 0;
+
+        Index freeHead_ = NIL;
+
+        Index head_ = NIL;
+
+        Index tail_ = NIL;
+
+        size_t indexedListSize_ = 0;
+
+        SlotAllocator slotAllocator_;
+
+        /**
+         * @brief Makes the list empty, the pool is forgotten without freeing it
+         */
+        void resetPool() noexcept {
+            slots_ = nullptr;
+            capacity_ = 0;
+            used_ = 0;
+            freeHead_ = NIL;
+            head_ = NIL;
+            tail_ = NIL;
+            indexedListSize_ = 0;
+        };
+
+        /**
+         * @return capacity of the pool after the next growth
+         */
+        Index grownCapacity() const {
+            if (capacity_ == NIL) {
+                throw LinkedLists::LinkedListsException("Can't grow the node pool beyond 32-bit indices");
+            }
+            if (capacity_ < MINIMAL_POOL_CAPACITY) {
+                return MINIMAL_POOL_CAPACITY;
+            }
+            return capacity_ > NIL / 2 ? NIL : capacity_ * 2;
+        };
+
+        /**
+         * @brief Moves the links of all handed out slots and the live elements to the same indices of target
+         *        On an exception target gets no elements, the current pool stays untouched
+         *
+         * @param target - pool of at least used_ slots
+         */
+        void moveSlotsTo(Slot *target) {
+            for (Index i = 0; i < used_; i++) {
+                target[i].prev = slots_[i].prev;
+                target[i].next = slots_[i].next;
+            }
+            Index current = head_;
+            try {
+                for (; current != NIL; current = slots_[current].next) {
+                    SlotAllocatorTraits::construct(slotAllocator_, target[current].value(),
+                                                   std::move_if_noexcept(*slots_[current].value()));
+                }
+            } catch (...) {
+                for (Index moved = head_; moved != current; moved = slots_[moved].next) {
+                    SlotAllocatorTraits::destroy(slotAllocator_, target[moved].value());
+                }
+                throw;
+            }
+        };
+
+        /**
+         * @brief Destroys the live elements of the current pool and replaces it with target
+         *
+         * @param target - pool which already holds the elements at the same indices
+         * @param capacity - number of slots in target
+         */
+        void replacePool(Slot *target, Index capacity) noexcept {
+            destroyElements();
+            if (slots_ != nullptr) {
+                SlotAllocatorTraits::deallocate(slotAllocator_, slots_, capacity_);
+            }
+            slots_ = target;
+            capacity_ = capacity;
+        };
+
+        /**
+         * @brief Reallocates the pool to the given capacity, indices of all slots are kept
+         *
+         * @param capacity - new number of slots, not less than used_
+         */
+        void reallocatePool(Index capacity) {
+            Slot *target = SlotAllocatorTraits::allocate(slotAllocator_, capacity);
+            try {
+                moveSlotsTo(target);
+            } catch (...) {
+                SlotAllocatorTraits::deallocate(slotAllocator_, target, capacity);
+                throw;
+            }
+            replacePool(target, capacity);
+        };
+
+        /**
+         * @brief Destroys the live elements without touching the links
+         */
+        void destroyElements() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (Index current = head_; current != NIL; current = slots_[current].next) {
+                    SlotAllocatorTraits::destroy(slotAllocator_, slots_[current].value());
+                }
+            }
+        };
+
+        /**
+         * @brief Takes a free slot and constructs the element in it, the slot is not linked yet
+         *        If the pool has to grow, the element is constructed in the new pool first,
+         *        so args may refer to the elements of the list
+         *
+         * @param args - arguments forwarded to the constructor of T
+         * @return index of the slot
+         */
+        template<class... Args>
+        Index constructInSlot(Args &&... args) {
+            if (freeHead_ != NIL) {
+                Index index = freeHead_;
+                SlotAllocatorTraits::construct(slotAllocator_, slots_[index].value(), std::forward<Args>(args)...);
+                freeHead_ = slots_[index].next;
+                return index;
+            }
+            if (used_ < capacity_) {
+                SlotAllocatorTraits::construct(slotAllocator_, slots_[used_].value(), std::forward<Args>(args)...);
+                return used_++;
+            }
+
+            Index capacity = grownCapacity();
+            Slot *target = SlotAllocatorTraits::allocate(slotAllocator_, capacity);
+            try {
+                SlotAllocatorTraits::construct(slotAllocator_, target[used_].value(), std::forward<Args>(args)...);
+            } catch (...) {
+                SlotAllocatorTraits::deallocate(slotAllocator_, target, capacity);
+                throw;
+            }
+            try {
+                moveSlotsTo(target);
+            } catch (...) {
+                SlotAllocatorTraits::destroy(slotAllocator_, target[used_].value());
+                SlotAllocatorTraits::deallocate(slotAllocator_, target, capacity);
+                throw;
+            }
+            replacePool(target, capacity);
+            return used_++;
+        };
+
+        /**
+         * @brief Links the slot before the slot before, NIL stands for the end of the list
+         *
+         * @param before - index of the slot before which the new one is linked
+         * @param index - index of the slot to link
+         */
+        void linkSlot(Index before, Index index) noexcept {
+            Index prev = before == NIL ? tail_ : slots_[before].prev;
+            slots_[index].prev = prev;
+            slots_[index].next = before;
+            if (prev == NIL) {
+                head_ = index;
+            } else {
+                slots_[prev].next = index;
+            }
+            if (before == NIL) {
+                tail_ = index;
+            } else {
+                slots_[before].prev = index;
+            }
+            ++indexedListSize_;
+        };
+
+        /**
+         * @brief Excludes the slot from the list, the element is kept
+         *
+         * @param index - index of the slot to unlink
+         */
+        void unlinkSlot(Index index) noexcept {
+            Index prev = slots_[index].prev;
+            Index next = slots_[index].next;
+            if (prev == NIL) {
+                head_ = next;
+            } else {
+                slots_[prev].next = next;
+            }
+            if (next == NIL) {
+                tail_ = prev;
+            } else {
+                slots_[next].prev = prev;
+            }
+            --indexedListSize_;
+        };
+
+        /**
+         * @brief Destroys the element of the unlinked slot and puts the slot to the free-index list
+         *
+         * @param index - index of the slot to free
+         */
+        void releaseSlot(Index index) noexcept {
+            SlotAllocatorTraits::destroy(slotAllocator_, slots_[index].value());
+            slots_[index].next = freeHead_;
+            freeHead_ = index;
+        };
+
+        /**
+         * @brief Copies all elements of other to the end of the current list
+         *        The number of elements is fixed before copying, so other may be the current list
+         *
+         * @param other - list to copy from
+         */
+        void appendCopyOf(const IndexedDoubleLinkedList &other) {
+            size_t count = other.size();
+            reserve(size() + count);
+            Index current = other.head_;
+            for (; count > 0; count--) {
+                Index index = constructInSlot(*other.slots_[current].value());
+                linkSlot(NIL, index);
+                current = other.slots_[current].next;
+            }
+        };
+
+    public:
+
+        using allocator_type = Allocator;
+
+        /**
+         * @class iterator
+         *
+         * @brief Implements the basic features of the classic non-const iterator from STL
+         *        It points to the list and to the slot index, so it survives the pool growth
+         */
+        class iterator {
+        private:
+
+            friend class IndexedDoubleLinkedList<T, Allocator>;
+
+            IndexedDoubleLinkedList *list_;
+
+            Index index_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            iterator(IndexedDoubleLinkedList *list, Index index) : list_(list), index_(index) {
+            };
+
+            bool operator!=(const iterator &other) const {
+                return list_ != other.list_ || index_ != other.index_;
+            };
+
+            bool operator==(const iterator &other) const {
+                return !(*this != other);
+            };
+
+            T &operator*() const {
+                return *list_->slots_[index_].value();
+            };
+
+            T *operator->() const {
+                return list_->slots_[index_].value();
+            };
+
+            iterator &operator++() {
+                index_ = list_->slots_[index_].next;
+                return *this;
+            };
+
+            iterator operator++(int) {
+                iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            iterator &operator--() {
+                index_ = index_ == NIL ? list_->tail_ : list_->slots_[index_].prev;
+                return *this;
+            };
+
+            iterator operator--(int) {
+                iterator old = *this;
+                --(*this);
+                return old;
+            };
+
+            /**
+             * @brief Offset the iterator by an arbitrary integer, backwards for a negative shift
+             *
+             * @param shift - the offset value of the iterator
+             * @param it - iterator to which the offset is applied
+             * @return iterator after applying the offset
+             */
+            friend iterator operator+(const std::ptrdiff_t shift, const iterator &it) {
+                iterator current(it);
+                for (std::ptrdiff_t i = 0; i < shift; i++) {
+                    ++current;
+                }
+                for (std::ptrdiff_t i = 0; i > shift; i--) {
+                    --current;
+                }
+                return current;
+            }
+
+            friend iterator operator+(const iterator &it, const std::ptrdiff_t shift) {
+                return shift + it;
+            }
+
+            friend iterator operator-(const iterator &it, const std::ptrdiff_t shift) {
+                return -shift + it;
+            }
+        };
+
+        /**
+         * @class const_iterator
+         *
+         * @brief Implements the basic features of the classic const iterator from STL
+         *        Implementation features are described in the class iterator
+         */
+        class const_iterator {
+        private:
+
+            friend class IndexedDoubleLinkedList<T, Allocator>;
+
+            const IndexedDoubleLinkedList *constList_;
+
+            Index index_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            const_iterator(const IndexedDoubleLinkedList *list, Index index) : constList_(list), index_(index) {
+            };
+
+            const_iterator(const iterator &other) : constList_(other.list_), index_(other.index_) {
+            };
+
+            bool operator!=(const const_iterator &other) const {
+                return constList_ != other.constList_ || index_ != other.index_;
+            };
+
+            bool operator==(const const_iterator &other) const {
+                return !(*this != other);
+            };
+
+            const T &operator*() const {
+                return *constList_->slots_[index_].value();
+            };
+
+            const T *operator->() const {
+                return constList_->slots_[index_].value();
+            };
+
+            const_iterator &operator++() {
+                index_ = constList_->slots_[index_].next;
+                return *this;
+            };
+
+            const_iterator operator++(int) {
+                const_iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            const_iterator &operator--() {
+                index_ = index_ == NIL ? constList_->tail_ : constList_->slots_[index_].prev;
+                return *this;
+            };
+
+            const_iterator operator--(int) {
+                const_iterator old = *this;
+                --(*this);
+                return old;
+            };
+
+            friend const_iterator operator+(const std::ptrdiff_t shift, const const_iterator &it) {
+                const_iterator current(it);
+                for (std::ptrdiff_t i = 0; i < shift; i++) {
+                    ++current;
+                }
+                for (std::ptrdiff_t i = 0; i > shift; i--) {
+                    --current;
+                }
+                return current;
+            }
+
+            friend const_iterator operator+(const const_iterator &it, const std::ptrdiff_t shift) {
+                return shift + it;
+            }
+
+            friend const_iterator operator-(const const_iterator &it, const std::ptrdiff_t shift) {
+                return -shift + it;
+            }
+        };
+
+        /**
+         * @brief Constructor - empty list initialization, no pool is allocated
+         */
+        IndexedDoubleLinkedList() noexcept(noexcept(Allocator())): IndexedDoubleLinkedList(Allocator()) {
+        };
+
+        /**
+         * @brief Constructor - empty list initialization with the given allocator
+         *
+         * @param allocator - allocator used for the pool
+         */
+        explicit IndexedDoubleLinkedList(const Allocator &allocator) noexcept: slotAllocator_(allocator) {
+        };
+
+        /**
+         * @brief Copy constructor
+         *        The copy takes a pool of exactly other.size() slots, laid out in the list order
+         *
+         * @param other - copy source
+         */
+        IndexedDoubleLinkedList(const IndexedDoubleLinkedList &other)
+                : IndexedDoubleLinkedList(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                other.get_allocator())) {
+            appendCopyOf(other);
+        };
+
+        /**
+         * @brief Move constructor
+         *        The pool is taken over as a whole, other stays a valid empty list
+         *
+         * @param other - list, the control on which need to move
+         */
+        IndexedDoubleLinkedList(IndexedDoubleLinkedList &&other) noexcept: slotAllocator_(other.slotAllocator_) {
+            swap(other);
+        };
+
+        /**
+         * @brief Destructor
+         */
+        ~IndexedDoubleLinkedList() {
+            clear();
+            if (slots_ != nullptr) {
+                SlotAllocatorTraits::deallocate(slotAllocator_, slots_, capacity_);
+            }
+        };
+
+        /**
+         * @brief Copy assignment
+         *
+         * @param other - the list to copy from
+         * @return rewritten existing list
+         */
+        IndexedDoubleLinkedList &operator=(const IndexedDoubleLinkedList &other) {
+            if (this != &other) {
+                clear();
+                if constexpr (SlotAllocatorTraits::propagate_on_container_copy_assignment::value) {
+                    if (slotAllocator_ != other.slotAllocator_) {
+                        if (slots_ != nullptr) {
+                            SlotAllocatorTraits::deallocate(slotAllocator_, slots_, capacity_);
+                        }
+                        resetPool();
+                    }
+                    slotAllocator_ = other.slotAllocator_;
+                }
+                appendCopyOf(other);
+            }
+            return *this;
+        };
+
+        /**
+         * @brief Move assignment
+         *        If the allocators do not propagate and are not equal, the elements are moved one by one
+         *
+         * @param other - the list to move from
+         * @return rewritten existing list
+         */
+        IndexedDoubleLinkedList &operator=(IndexedDoubleLinkedList &&other) noexcept(
+                SlotAllocatorTraits::propagate_on_container_move_assignment::value ||
+                SlotAllocatorTraits::is_always_equal::value) {
+            if (this != &other) {
+                clear();
+                if constexpr (!SlotAllocatorTraits::propagate_on_container_move_assignment::value) {
+                    if (slotAllocator_ != other.slotAllocator_) {
+                        reserve(other.size());
+                        for (T &value : other) {
+                            push_back(std::move(value));
+                        }
+                        other.clear();
+                        return *this;
+                    }
+                }
+                if (slots_ != nullptr) {
+                    SlotAllocatorTraits::deallocate(slotAllocator_, slots_, capacity_);
+                }
+                resetPool();
+                if constexpr (SlotAllocatorTraits::propagate_on_container_move_assignment::value) {
+                    slotAllocator_ = other.slotAllocator_;
+                }
+                swap(other);
+            }
+            return *this;
+        };
+
+        /**
+         * @brief Exchanges the contents of two lists without allocations
+         *
+         * @param other - the list to exchange with
+         */
+        void swap(IndexedDoubleLinkedList &other) noexcept {
+            using std::swap;
+            if constexpr (SlotAllocatorTraits::propagate_on_container_swap::value) {
+                swap(slotAllocator_, other.slotAllocator_);
+            }
+            swap(slots_, other.slots_);
+            swap(capacity_, other.capacity_);
+            swap(used_, other.used_);
+            swap(freeHead_, other.freeHead_);
+            swap(head_, other.head_);
+            swap(tail_, other.tail_);
+            swap(indexedListSize_, other.indexedListSize_);
+        };
+
+        /**
+         * @return copy of the allocator used by the list
+         */
+        allocator_type get_allocator() const {
+            return allocator_type(slotAllocator_);
+        };
+
+        /**
+         * @return number of slots in the pool
+         */
+        [[nodiscard]] size_t capacity() const {
+            return capacity_;
+        };
+
+        /**
+         * @brief Grows the pool to hold at least count elements
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param count - number of elements to prepare slots for
+         */
+        void reserve(size_t count) {
+            if (count <= capacity_) {
+                return;
+            }
+            if (count >= NIL) {
+                throw LinkedLists::LinkedListsException("Can't grow the node pool beyond 32-bit indices");
+            }
+            reallocatePool(static_cast<Index>(count));
+        };
+
+        /**
+         * @brief Moves the elements to a pool of exactly size() slots, laid out in the list order
+         *        Afterwards a traversal reads the pool from the beginning to the end
+         *        All iterators are invalidated
+         */
+        void shrink_to_fit() {
+            if (empty()) {
+                if (slots_ != nullptr) {
+                    SlotAllocatorTraits::deallocate(slotAllocator_, slots_, capacity_);
+                }
+                resetPool();
+                return;
+            }
+
+            IndexedDoubleLinkedList dense(slotAllocator_);
+            dense.reserve(size());
+            for (T &value : *this) {
+                dense.linkSlot(NIL, dense.constructInSlot(std::move_if_noexcept(value)));
+            }
+            swap(dense);
+        };
+
+        iterator begin() {
+            return iterator(this, head_);
+        };
+
+        const_iterator begin() const {
+            return const_iterator(this, head_);
+        };
+
+        const_iterator cbegin() const {
+            return const_iterator(this, head_);
+        };
+
+        iterator end() {
+            return iterator(this, NIL);
+        };
+
+        const_iterator end() const {
+            return const_iterator(this, NIL);
+        };
+
+        const_iterator cend() const {
+            return const_iterator(this, NIL);
+        };
+
+        /**
+         * @return list size
+         */
+        [[nodiscard]] size_t size() const {
+            return indexedListSize_;
+        };
+
+        /**
+         * @return true, if the list is empty
+         *         false, if not
+         */
+        [[nodiscard]] bool empty() const {
+            return indexedListSize_ == 0;
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the first element in the list
+         */
+        T &front() {
+            if (!empty()) {
+                return *slots_[head_].value();
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the first item in the list");
+            }
+        };
+
+        const T &front() const {
+            if (!empty()) {
+                return *slots_[head_].value();
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the first item in the list");
+            }
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the last element in the list
+         */
+        T &back() {
+            if (!empty()) {
+                return *slots_[tail_].value();
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the last item in the list");
+            }
+        };
+
+        const T &back() const {
+            if (!empty()) {
+                return *slots_[tail_].value();
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the last item in the list");
+            }
+        };
+
+        /**
+         * @brief Constructs the new element in a free slot and links it before the element pointed to by before
+         *
+         * @param before - iterator, before which need to add a new element
+         * @param args - arguments forwarded to the constructor of T
+         * @return iterator that points to the new element in the list
+         */
+        template<class... Args>
+        iterator emplace(iterator before, Args &&... args) {
+            Index index = constructInSlot(std::forward<Args>(args)...);
+            linkSlot(before.index_, index);
+            return iterator(this, index);
+        };
+
+        iterator insert(iterator before, const T &value) {
+            return emplace(before, value);
+        };
+
+        iterator insert(iterator before, T &&value) {
+            return emplace(before, std::move(value));
+        };
+
+        template<class... Args>
+        T &emplace_back(Args &&... args) {
+            return *emplace(end(), std::forward<Args>(args)...);
+        };
+
+        template<class... Args>
+        T &emplace_front(Args &&... args) {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        };
+
+        void push_back(const T &value) {
+            emplace(end(), value);
+        };
+
+        void push_back(T &&value) {
+            emplace(end(), std::move(value));
+        };
+
+        void push_front(const T &value) {
+            emplace(begin(), value);
+        };
+
+        void push_front(T &&value) {
+            emplace(begin(), std::move(value));
+        };
+
+        /**
+         * @brief Deletes the element pointed to by the position iterator, its slot goes to the free-index list
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param position - iterator that points to the element to delete
+         * @return iterator to the next element that fell into place of the deleted one
+         */
+        iterator erase(iterator position) {
+            if (position == end()) {
+                throw LinkedLists::LinkedListsException("Can't erase a nonexistent element in erase method");
+            }
+
+            Index next = slots_[position.index_].next;
+            unlinkSlot(position.index_);
+            releaseSlot(position.index_);
+            return iterator(this, next);
+        };
+
+        /**
+         * @brief Deletes the elements pointed from begin to end (not include) iterators
+         *
+         * @param begin - iterator that points to the element to start delete
+         * @param end - iterator that points to the element to finish delete
+         * @return iterator to the element after the deleted ones
+         */
+        iterator erase(iterator begin, iterator end) {
+            while (begin != end) {
+                begin = erase(begin);
+            }
+            return end;
+        };
+
+        /**
+         * @brief Delete all list elements which contains data = value
+         *
+         * @param value - the data elements which will be deleted
+         * @return number of deleted elements in the list
+         */
+        size_t remove(const T &value) {
+            size_t counter = 0;
+            iterator current = begin();
+            while (current != end()) {
+                if (*current == value) {
+                    current = erase(current);
+                    ++counter;
+                } else {
+                    ++current;
+                }
+            }
+            return counter;
+        };
+
+        /**
+         * @brief Destroys all elements, the pool is kept for the next insertions
+         */
+        void clear() {
+            destroyElements();
+            used_ = 0;
+            freeHead_ = NIL;
+            head_ = NIL;
+            tail_ = NIL;
+            indexedListSize_ = 0;
+        };
+
+        void pop_back() {
+            erase(--end());
+        };
+
+        void pop_front() {
+            erase(begin());
+        };
+
+        /**
+         * @brief Adds another existing list to the end of the current list
+         *
+         * @param other - the list that will be attached to the end of the current one
+         * @return advanced existing list
+         */
+        IndexedDoubleLinkedList &operator+=(const IndexedDoubleLinkedList &other) {
+            appendCopyOf(other);
+            return *this;
+        };
+
+        /**
+         * @brief Moves the elements of another list to the end of the current list
+         *        The lists have separate pools, so the elements are moved into the slots of the current one
+         *
+         * @param other - the list that will be attached to the end of the current one, it becomes empty
+         * @return advanced existing list
+         */
+        IndexedDoubleLinkedList &operator+=(IndexedDoubleLinkedList &&other) {
+            splice(end(), other);
+            return *this;
+        };
+
+        /**
+         * @brief Moves all elements of other before the element pointed to by before
+         *        Every list owns its pool, so the elements are moved into new slots of the current list
+         *
+         * @param before - iterator of the current list, before which the elements are placed
+         * @param other - another list, it becomes empty
+         */
+        void splice(iterator before, IndexedDoubleLinkedList &other) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            reserve(size() + other.size());
+            for (T &value : other) {
+                emplace(before, std::move(value));
+            }
+            other.clear();
+        };
+
+        void splice(iterator before, IndexedDoubleLinkedList &&other) {
+            splice(before, other);
+        };
+
+        /**
+         * @brief Moves the element pointed to by position from other before the element pointed to by before
+         *        Within one list the slot is relinked in O(1), from another list the element is moved
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param before - iterator of the current list, before which the element is placed
+         * @param other - list which owns the element, it may be the current list
+         * @param position - iterator to the element to move
+         */
+        void splice(iterator before, IndexedDoubleLinkedList &other, iterator position) {
+            if (position == other.end()) {
+                throw LinkedLists::LinkedListsException("Can't splice a nonexistent element in splice method");
+            }
+            if (this != &other) {
+                emplace(before, std::move(*position));
+                other.erase(position);
+                return;
+            }
+            Index index = position.index_;
+            if (index == before.index_ || slots_[index].next == before.index_) {
+                return;
+            }
+            unlinkSlot(index);
+            linkSlot(before.index_, index);
+        };
+
+        void splice(iterator before, IndexedDoubleLinkedList &&other, iterator position) {
+            splice(before, other, position);
+        };
+
+        /**
+         * @brief Moves the elements from first to last (not include) of other before the element pointed to by before
+         *        Within one list the slots are relinked, from another list the elements are moved
+         *
+         * @param before - iterator of the current list, before which the elements are placed,
+         *                 it must not be in the range
+         * @param other - list which owns the elements, it may be the current list
+         * @param first - iterator to the first element to move
+         * @param last - iterator to the element after the last one to move
+         */
+        void splice(iterator before, IndexedDoubleLinkedList &other, iterator first, iterator last) {
+            while (first != last) {
+                iterator next = first;
+                ++next;
+                splice(before, other, first);
+                first = next;
+            }
+        };
+
+        void splice(iterator before, IndexedDoubleLinkedList &&other, iterator first, iterator last) {
+            splice(before, other, first, last);
+        };
+    };
+
+    template<class T, class Allocator>
+    void swap(IndexedDoubleLinkedList<T, Allocator> &left, IndexedDoubleLinkedList<T, Allocator> &right) noexcept {
+        left.swap(right);
+    }
+
+    /**
+     * @brief Compares two lists element by element for the equality
+     *
+     * @param left - first list to compare
+     * @param right - second list to compare
+     * @return true, if the lists are equal
+     *         false, if not
+     */
+    template<class T, class Allocator>
+    bool operator==(const IndexedDoubleLinkedList<T, Allocator> &left,
+                    const IndexedDoubleLinkedList<T, Allocator> &right) {
+        if (left.size() != right.size()) {
+            return false;
+        }
+        auto rightIterator = right.cbegin();
+        for (auto leftIterator = left.cbegin(); leftIterator != left.cend(); ++leftIterator, ++rightIterator) {
+            if (*leftIterator != *rightIterator) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compares two lists element by element for the inequality
+     *
+     * @param left - first list to compare
+     * @param right - second list to compare
+     * @return true, if the lists are not equal
+     *         false, if equal
+     */
+    template<class T, class Allocator>
+    bool operator!=(const IndexedDoubleLinkedList<T, Allocator> &left,
+                    const IndexedDoubleLinkedList<T, Allocator> &right) {
+        return !(left == right);
+    }
+
+    /**
+     * @brief Outputs the entire list to out using the following template:
+     *        [el_1 <---> el_2 <---> ... <---> el_n]
+     *
+     * @param out - output stream
+     * @param indexedList - the list for print to the out stream
+     * @return output stream after using
+     */
+    template<class T, class Allocator>
+    std::ostream &operator<<(std::ostream &out, const IndexedDoubleLinkedList<T, Allocator> &indexedList) {
+        out << "[";
+        size_t printed = 0;
+        for (auto current = indexedList.cbegin(); current != indexedList.cend(); ++current) {
+            out << *current;
+            if (++printed != indexedList.size()) {
+                out << " <---> ";
+            }
+        }
+        out << "]" << std::endl;
+        return out;
+    }
+
+    /**
+     * @brief Merges two lists into one
+     *
+     * @param left - first list to join
+     * @param right - second list to join
+     * @return merged list
+     */
+    template<class T, class Allocator>
+    IndexedDoubleLinkedList<T, Allocator> operator+(const IndexedDoubleLinkedList<T, Allocator> &left,
+                                                    const IndexedDoubleLinkedList<T, Allocator> &right) {
+        IndexedDoubleLinkedList<T, Allocator> list(left);
+        list += right;
+        return list;
+    }
+
+}
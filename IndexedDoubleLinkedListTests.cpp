@@ -0,0 +1,133 @@
+#include "IndexedDoubleLinkedList.h"
+#include "ListTestHarness.h"
+#include "gtest/gtest.h"
+
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace googleTests {
+
+    INSTANTIATE_TYPED_TEST_SUITE_P(Indexed, ListReferenceFixtureClassTest,
+                                   ::testing::Types<LinkedLists::IndexedDoubleLinkedList<int>>);
+
+    class IndexedDoubleLinkedListFixtureClassTest : public ::testing::Test {
+    protected:
+
+        using IndexedList = LinkedLists::IndexedDoubleLinkedList<int>;
+
+        void SetUp() override {
+            for (int i = 0; i < 10; i++) {
+                nonEmptyList.push_back(i);
+            }
+        }
+
+        IndexedList emptyList;
+        IndexedList nonEmptyList;
+
+    };
+
+    TEST_F(IndexedDoubleLinkedListFixtureClassTest, ErasedSlotsAreReused) {
+        EXPECT_EQ(0, emptyList.capacity());
+        size_t capacity = nonEmptyList.capacity();
+        EXPECT_GE(capacity, nonEmptyList.size());
+        for (int i = 0; i < 5; i++) {
+            nonEmptyList.erase(nonEmptyList.begin() + 2);
+        }
+        for (int i = 0; i < 5; i++) {
+            nonEmptyList.push_front(-i);
+        }
+        EXPECT_EQ(10, nonEmptyList.size());
+        EXPECT_EQ(capacity, nonEmptyList.capacity());
+        EXPECT_EQ(-4, nonEmptyList.front());
+        EXPECT_EQ(9, nonEmptyList.back());
+    }
+
+    TEST_F(IndexedDoubleLinkedListFixtureClassTest, IteratorsSurvivePoolGrowth) {
+        auto third = nonEmptyList.begin() + 2;
+        size_t capacity = nonEmptyList.capacity();
+        while (nonEmptyList.capacity() == capacity) {
+            // The argument refers to the element of the list, which is relocated by the growth
+            nonEmptyList.push_back(nonEmptyList.front());
+        }
+        EXPECT_EQ(2, *third);
+        EXPECT_EQ(0, nonEmptyList.back());
+        EXPECT_EQ(1, *(--third));
+
+        nonEmptyList.erase(nonEmptyList.begin() + 10, nonEmptyList.end());
+        nonEmptyList.shrink_to_fit();
+        EXPECT_EQ(10, nonEmptyList.capacity());
+        EXPECT_EQ("[0 <---> 1 <---> 2 <---> 3 <---> 4 <---> 5 <---> 6 <---> 7 <---> 8 <---> 9]\n",
+                  (std::stringstream() << nonEmptyList).str());
+    }
+
+    TEST_F(IndexedDoubleLinkedListFixtureClassTest, InsertAndEraseThroughIteratorsTakenBeforeGrowth) {
+        std::list<int> reference(nonEmptyList.begin(), nonEmptyList.end());
+        auto first = nonEmptyList.begin();
+        auto fifth = nonEmptyList.begin() + 4;
+        auto last = --nonEmptyList.end();
+        auto end = nonEmptyList.end();
+        size_t capacity = nonEmptyList.capacity();
+
+        // Every insertion goes through an iterator taken before the pool moved
+        for (int i = 0; nonEmptyList.capacity() < 4 * capacity; i++) {
+            nonEmptyList.insert(fifth, 100 + i);
+            reference.insert(std::next(reference.begin(), 4 + i), 100 + i);
+        }
+        nonEmptyList.insert(end, -1);
+        reference.push_back(-1);
+        EXPECT_EQ(true, isEqualToReference(nonEmptyList, reference));
+        EXPECT_EQ(0, *first);
+        EXPECT_EQ(4, *fifth);
+        EXPECT_EQ(-1, *(++last));
+
+        fifth = nonEmptyList.erase(fifth);
+        reference.remove(4);
+        EXPECT_EQ(5, *fifth);
+        nonEmptyList.erase(first);
+        reference.pop_front();
+        EXPECT_EQ(true, isEqualToReference(nonEmptyList, reference));
+        EXPECT_LE(nonEmptyList.size(), nonEmptyList.capacity());
+    }
+
+    TEST_F(IndexedDoubleLinkedListFixtureClassTest, CopyMoveSpliceAndCompare) {
+        IndexedList copiedList(nonEmptyList);
+        EXPECT_EQ(true, copiedList == nonEmptyList);
+        EXPECT_EQ(10, copiedList.capacity());
+        copiedList.back() = -1;
+        EXPECT_EQ(true, copiedList != nonEmptyList);
+
+        IndexedList movedList(std::move(copiedList));
+        EXPECT_EQ(true, copiedList.empty());
+        copiedList = nonEmptyList + movedList;
+        EXPECT_EQ(20, copiedList.size());
+        EXPECT_EQ(-1, copiedList.back());
+
+        // Within one list the slot is relinked, from another list the element is moved
+        copiedList.splice(copiedList.begin(), copiedList, --copiedList.end());
+        EXPECT_EQ(-1, copiedList.front());
+        copiedList.splice(copiedList.end(), movedList, movedList.begin(), movedList.begin() + 3);
+        EXPECT_EQ(7, movedList.size());
+        EXPECT_EQ(23, copiedList.size());
+        EXPECT_EQ(2, copiedList.back());
+        copiedList += std::move(movedList);
+        EXPECT_EQ(true, movedList.empty());
+        EXPECT_EQ(30, copiedList.size());
+        EXPECT_EQ(2, copiedList.remove(-1));
+    }
+
+    TEST_F(IndexedDoubleLinkedListFixtureClassTest, MoveOnlyElements) {
+        LinkedLists::IndexedDoubleLinkedList<std::unique_ptr<std::string>> list;
+        for (int i = 0; i < 10; i++) {
+            list.emplace_front(new std::string(std::to_string(i)));
+        }
+        list.erase(list.begin() + 3, list.begin() + 8);
+        EXPECT_EQ(5, list.size());
+        EXPECT_EQ("9", *list.front());
+        EXPECT_EQ("0", *list.back());
+        list.clear();
+        EXPECT_EQ(true, list.empty());
+    }
+
+}
@@ -0,0 +1,605 @@
+#pragma once
+
+#include "LinkedListsException.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace LinkedLists {
+
+    /**
+     * @class ListHook
+     *
+     * @brief Links embedded into an object to put it into IntrusiveDoubleLinkedList
+     *        An object with several hooks may sit in several lists at once
+     *        The hook is not copied with the object: a copy starts unlinked
+     */
+    class ListHook {
+    private:
+
+        template<class T, ListHook T::*Hook>
+        friend class IntrusiveDoubleLinkedList;
+
+        ListHook *prev_ = nullptr;
+
+        ListHook *next_ = nullptr;
+    public:
+
+        ListHook() = default;
+
+        ListHook(const ListHook &) noexcept {
+        };
+
+        ListHook &operator=(const ListHook &) noexcept {
+            return *this;
+        };
+
+        /**
+         * @return true, if the object is in a list through this hook
+         *         false, if not
+         */
+        [[nodiscard]] bool is_linked() const {
+            return next_ != nullptr;
+        };
+    };
+
+    /**
+     * @class IntrusiveDoubleLinkedList
+     *
+     * @brief Implements a template doubly linked list of objects which are owned elsewhere
+     *        The list links the ListHook member of the objects, so nothing is allocated or copied
+     *        and an object is unlinked in O(1) given only a reference to it
+     *
+     *        It keeps the ring view of DoubleLinkedList: the sentinel hook stored inside
+     *        the list object points to both the first and the last object
+     *
+     *        The objects must stay alive and in place while they are in the list,
+     *        the list unlinks the remaining ones when it is destroyed
+     *
+     * @author Andrey Valitov
+     *
+     * @version 1.0
+     *
+     * @tparam T
+     * @tparam Hook - pointer to the ListHook member of T which links the objects of this list
+     */
+    template<class T, ListHook T::*Hook>
+    class IntrusiveDoubleLinkedList {
+    private:
+
+        ListHook sentinel_;
+
+        size_t intrusiveListSize_;
+
+        /**
+         * @return offset of the hook inside T
+         */
+        static std::ptrdiff_t hookOffset() {
+            static const std::ptrdiff_t offset = [] {
+                // Only the addresses of a fake object are taken, no object is constructed
+                alignas(T) static unsigned char storage[sizeof(T)];
+                const T *object = reinterpret_cast<const T *>(storage);
+                return reinterpret_cast<const unsigned char *>(&(object->*Hook)) - storage;
+            }();
+            return offset;
+        };
+
+        static T *asObject(ListHook *hook) {
+            return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) - hookOffset());
+        };
+
+        static const T *asObject(const ListHook *hook) {
+            return reinterpret_cast<const T *>(reinterpret_cast<const unsigned char *>(hook) - hookOffset());
+        };
+
+        /**
+         * @brief Makes the empty ring of the sentinel
+         */
+        void resetSentinel() noexcept {
+            sentinel_.prev_ = &sentinel_;
+            sentinel_.next_ = &sentinel_;
+            intrusiveListSize_ = 0;
+        };
+
+        /**
+         * @brief Links the hook of the object before the hook pointed to by before
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param before - hook before which the object is linked
+         * @param object - object to link
+         * @return hook of the object
+         */
+        ListHook *linkBefore(ListHook *before, T &object) {
+            ListHook *hook = &(object.*Hook);
+            if (hook->is_linked()) {
+                throw LinkedLists::LinkedListsException("Can't link an object which is already in a list by this hook");
+            }
+            ListHook *savePrevBefore = before->prev_;
+            savePrevBefore->next_ = hook;
+            hook->prev_ = savePrevBefore;
+            hook->next_ = before;
+            before->prev_ = hook;
+            ++intrusiveListSize_;
+            return hook;
+        };
+
+        /**
+         * @brief Excludes the hook from the ring and marks it unlinked
+         *
+         * @param hook - hook to unlink
+         * @return hook which was after the unlinked one
+         */
+        ListHook *unlinkHook(ListHook *hook) noexcept {
+            ListHook *next = hook->next_;
+            hook->prev_->next_ = next;
+            next->prev_ = hook->prev_;
+            hook->prev_ = nullptr;
+            hook->next_ = nullptr;
+            --intrusiveListSize_;
+            return next;
+        };
+
+    public:
+
+        /**
+         * @class iterator
+         *
+         * @brief Implements the basic features of the classic non-const iterator from STL
+         *        It points to the hook, the object is found by the offset of the hook
+         */
+        class iterator {
+        private:
+
+            friend class IntrusiveDoubleLinkedList<T, Hook>;
+
+            ListHook *hook_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            explicit iterator(ListHook *hook) : hook_(hook) {
+            };
+
+            bool operator!=(const iterator &other) const {
+                return hook_ != other.hook_;
+            };
+
+            bool operator==(const iterator &other) const {
+                return hook_ == other.hook_;
+            };
+
+            T &operator*() const {
+                return *asObject(hook_);
+            };
+
+            T *operator->() const {
+                return asObject(hook_);
+            };
+
+            iterator &operator++() {
+                hook_ = hook_->next_;
+                return *this;
+            };
+
+            iterator operator++(int) {
+                iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            iterator &operator--() {
+                hook_ = hook_->prev_;
+                return *this;
+            };
+
+            iterator operator--(int) {
+                iterator old = *this;
+                --(*this);
+                return old;
+            };
+        };
+
+        /**
+         * @class const_iterator
+         *
+         * @brief Implements the basic features of the classic const iterator from STL
+         *        Implementation features are described in the class iterator
+         */
+        class const_iterator {
+        private:
+
+            friend class IntrusiveDoubleLinkedList<T, Hook>;
+
+            const ListHook *constHook_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            explicit const_iterator(const ListHook *hook) : constHook_(hook) {
+            };
+
+            const_iterator(const iterator &other) : constHook_(other.hook_) {
+            };
+
+            bool operator!=(const const_iterator &other) const {
+                return constHook_ != other.constHook_;
+            };
+
+            bool operator==(const const_iterator &other) const {
+                return constHook_ == other.constHook_;
+            };
+
+            const T &operator*() const {
+                return *asObject(constHook_);
+            };
+
+            const T *operator->() const {
+                return asObject(constHook_);
+            };
+
+            const_iterator &operator++() {
+                constHook_ = constHook_->next_;
+                return *this;
+            };
+
+            const_iterator operator++(int) {
+                const_iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            const_iterator &operator--() {
+                constHook_ = constHook_->prev_;
+                return *this;
+            };
+
+            const_iterator operator--(int) {
+                const_iterator old = *this;
+                --(*this);
+                return old;
+            };
+        };
+
+        /**
+         * @brief Constructor - empty list initialization
+         */
+        IntrusiveDoubleLinkedList() noexcept {
+            resetSentinel();
+        };
+
+        IntrusiveDoubleLinkedList(const IntrusiveDoubleLinkedList &other) = delete;
+
+        IntrusiveDoubleLinkedList &operator=(const IntrusiveDoubleLinkedList &other) = delete;
+
+        /**
+         * @brief Move constructor
+         *        The objects are relinked to the new sentinel, other stays a valid empty list
+         *
+         * @param other - list, the control on which need to move
+         */
+        IntrusiveDoubleLinkedList(IntrusiveDoubleLinkedList &&other) noexcept {
+            resetSentinel();
+            swap(other);
+        };
+
+        /**
+         * @brief Move assignment
+         *        The objects of the current list are unlinked, the objects of other are relinked
+         *
+         * @param other - the list to move from
+         * @return rewritten existing list
+         */
+        IntrusiveDoubleLinkedList &operator=(IntrusiveDoubleLinkedList &&other) noexcept {
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        };
+
+        /**
+         * @brief Destructor
+         *        The objects are not destroyed, their hooks are only marked unlinked
+         */
+        ~IntrusiveDoubleLinkedList() {
+            clear();
+        };
+
+        /**
+         * @brief Exchanges the contents of two lists, only the sentinels are relinked
+         *
+         * @param other - the list to exchange with
+         */
+        void swap(IntrusiveDoubleLinkedList &other) noexcept {
+            if (this == &other) {
+                return;
+            }
+            ListHook *head = empty() ? nullptr : sentinel_.next_;
+            ListHook *tail = sentinel_.prev_;
+            ListHook *otherHead = other.empty() ? nullptr : other.sentinel_.next_;
+            ListHook *otherTail = other.sentinel_.prev_;
+            size_t size = intrusiveListSize_;
+            size_t otherSize = other.intrusiveListSize_;
+            other.resetSentinel();
+            if (head != nullptr) {
+                other.sentinel_.next_ = head;
+                other.sentinel_.prev_ = tail;
+                head->prev_ = &other.sentinel_;
+                tail->next_ = &other.sentinel_;
+                other.intrusiveListSize_ = size;
+            }
+            resetSentinel();
+            if (otherHead != nullptr) {
+                sentinel_.next_ = otherHead;
+                sentinel_.prev_ = otherTail;
+                otherHead->prev_ = &sentinel_;
+                otherTail->next_ = &sentinel_;
+                intrusiveListSize_ = otherSize;
+            }
+        };
+
+        iterator begin() {
+            return iterator(sentinel_.next_);
+        };
+
+        const_iterator begin() const {
+            return const_iterator(sentinel_.next_);
+        };
+
+        const_iterator cbegin() const {
+            return const_iterator(sentinel_.next_);
+        };
+
+        iterator end() {
+            return iterator(&sentinel_);
+        };
+
+        const_iterator end() const {
+            return const_iterator(&sentinel_);
+        };
+
+        const_iterator cend() const {
+            return const_iterator(&sentinel_);
+        };
+
+        /**
+         * @brief Finds the position of the object in O(1)
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param object - object linked into the list
+         * @return iterator that points to the object
+         */
+        iterator iterator_to(T &object) {
+            if (!(object.*Hook).is_linked()) {
+                throw LinkedLists::LinkedListsException("Can't make an iterator to an object which is not in a list");
+            }
+            return iterator(&(object.*Hook));
+        };
+
+        const_iterator iterator_to(const T &object) const {
+            if (!(object.*Hook).is_linked()) {
+                throw LinkedLists::LinkedListsException("Can't make an iterator to an object which is not in a list");
+            }
+            return const_iterator(&(object.*Hook));
+        };
+
+        /**
+         * @return list size
+         */
+        [[nodiscard]] size_t size() const {
+            return intrusiveListSize_;
+        };
+
+        /**
+         * @return true, if the list is empty
+         *         false, if not
+         */
+        [[nodiscard]] bool empty() const {
+            return intrusiveListSize_ == 0;
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the first object in the list
+         */
+        T &front() {
+            if (!empty()) {
+                return *asObject(sentinel_.next_);
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the first item in the list");
+            }
+        };
+
+        const T &front() const {
+            if (!empty()) {
+                return *asObject(sentinel_.next_);
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the first item in the list");
+            }
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the last object in the list
+         */
+        T &back() {
+            if (!empty()) {
+                return *asObject(sentinel_.prev_);
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the last item in the list");
+            }
+        };
+
+        const T &back() const {
+            if (!empty()) {
+                return *asObject(sentinel_.prev_);
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the last item in the list");
+            }
+        };
+
+        /**
+         * @brief Links the object before the object pointed to by before
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param before - iterator, before which need to link the object
+         * @param object - object which is not linked by this hook yet
+         * @return iterator that points to the object in the list
+         */
+        iterator insert(iterator before, T &object) {
+            return iterator(linkBefore(before.hook_, object));
+        };
+
+        void push_back(T &object) {
+            linkBefore(&sentinel_, object);
+        };
+
+        void push_front(T &object) {
+            linkBefore(sentinel_.next_, object);
+        };
+
+        /**
+         * @brief Unlinks the object pointed to by the position iterator, the object itself is kept
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param position - iterator that points to the object to unlink
+         * @return iterator to the next object that fell into place of the unlinked one
+         */
+        iterator erase(iterator position) {
+            if (position == end()) {
+                throw LinkedLists::LinkedListsException("Can't erase a nonexistent element in erase method");
+            }
+            return iterator(unlinkHook(position.hook_));
+        };
+
+        /**
+         * @brief Unlinks the objects pointed from begin to end (not include) iterators
+         *
+         * @param begin - iterator that points to the object to start unlink
+         * @param end - iterator that points to the object to finish unlink
+         * @return iterator to the object after the unlinked ones
+         */
+        iterator erase(iterator begin, iterator end) {
+            while (begin != end) {
+                begin = erase(begin);
+            }
+            return end;
+        };
+
+        /**
+         * @brief Unlinks the object from the list in O(1)
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param object - object linked into the list
+         */
+        void erase(T &object) {
+            erase(iterator_to(object));
+        };
+
+        /**
+         * @brief Unlinks all objects, they are not destroyed
+         */
+        void clear() {
+            ListHook *current = sentinel_.next_;
+            while (current != &sentinel_) {
+                ListHook *next = current->next_;
+                current->prev_ = nullptr;
+                current->next_ = nullptr;
+                current = next;
+            }
+            resetSentinel();
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         */
+        void pop_back() {
+            if (empty()) {
+                throw LinkedLists::LinkedListsException("Can't pop the last element of the empty list");
+            }
+            unlinkHook(sentinel_.prev_);
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         */
+        void pop_front() {
+            if (empty()) {
+                throw LinkedLists::LinkedListsException("Can't pop the first element of the empty list");
+            }
+            unlinkHook(sentinel_.next_);
+        };
+
+        /**
+         * @brief Moves all objects of other before the object pointed to by before
+         *        Hooks are relinked in O(1)
+         *
+         * @param before - iterator of the current list, before which the objects are placed
+         * @param other - another list, it becomes empty
+         */
+        void splice(iterator before, IntrusiveDoubleLinkedList &other) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            ListHook *head = other.sentinel_.next_;
+            ListHook *tail = other.sentinel_.prev_;
+            size_t count = other.intrusiveListSize_;
+            other.resetSentinel();
+
+            ListHook *savePrevBefore = before.hook_->prev_;
+            savePrevBefore->next_ = head;
+            head->prev_ = savePrevBefore;
+            tail->next_ = before.hook_;
+            before.hook_->prev_ = tail;
+            intrusiveListSize_ += count;
+        };
+    };
+
+    template<class T, ListHook T::*Hook>
+    void swap(IntrusiveDoubleLinkedList<T, Hook> &left, IntrusiveDoubleLinkedList<T, Hook> &right) noexcept {
+        left.swap(right);
+    }
+
+    /**
+     * @brief Outputs the entire list to out using the following template:
+     *        [el_1 <---> el_2 <---> ... <---> el_n]
+     *
+     * @param out - output stream
+     * @param intrusiveList - the list for print to the out stream
+     * @return output stream after using
+     */
+    template<class T, ListHook T::*Hook>
+    std::ostream &operator<<(std::ostream &out, const IntrusiveDoubleLinkedList<T, Hook> &intrusiveList) {
+        out << "[";
+        size_t printed = 0;
+        for (auto current = intrusiveList.cbegin(); current != intrusiveList.cend(); ++current) {
+            out << *current;
+            if (++printed != intrusiveList.size()) {
+                out << " <---> ";
+            }
+        }
+        out << "]" << std::endl;
+        return out;
+    }
+
+}
@@ -0,0 +1,148 @@
+#include "IntrusiveDoubleLinkedList.h"
+#include "LinkedListsException.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace googleTests {
+
+    const static size_t INTRUSIVE_OBJECTS_AMOUNT = 10;
+
+    struct PooledObject {
+        std::string name;
+        int value;
+        LinkedLists::ListHook allHook;
+        LinkedLists::ListHook evenHook;
+
+        PooledObject(std::string name, int value) : name(std::move(name)), value(value) {
+        }
+
+        friend std::ostream &operator<<(std::ostream &out, const PooledObject &object) {
+            return out << object.value;
+        }
+    };
+
+    class IntrusiveDoubleLinkedListFixtureClassTest : public ::testing::Test {
+    protected:
+
+        using AllList = LinkedLists::IntrusiveDoubleLinkedList<PooledObject, &PooledObject::allHook>;
+        using EvenList = LinkedLists::IntrusiveDoubleLinkedList<PooledObject, &PooledObject::evenHook>;
+
+        void SetUp() override {
+            // The pool is filled before linking, the objects must not move while they are in the lists
+            pool.reserve(INTRUSIVE_OBJECTS_AMOUNT);
+            for (int i = 0; i < static_cast<int>(INTRUSIVE_OBJECTS_AMOUNT); i++) {
+                pool.emplace_back(std::to_string(i), i);
+            }
+            for (PooledObject &object : pool) {
+                allList.push_back(object);
+                if (object.value % 2 == 0) {
+                    evenList.push_back(object);
+                }
+            }
+        }
+
+        std::vector<PooledObject> pool;
+        AllList allList;
+        EvenList evenList;
+    };
+
+    TEST_F(IntrusiveDoubleLinkedListFixtureClassTest, IsEmpty) {
+        AllList emptyList;
+        EXPECT_EQ(true, emptyList.empty());
+        EXPECT_EQ(0, emptyList.size());
+        EXPECT_EQ(true, emptyList.begin() == emptyList.end());
+        EXPECT_THROW(emptyList.front(), LinkedLists::LinkedListsException);
+        EXPECT_THROW(emptyList.back(), LinkedLists::LinkedListsException);
+        EXPECT_THROW(emptyList.pop_front(), LinkedLists::LinkedListsException);
+        EXPECT_THROW(emptyList.erase(emptyList.end()), LinkedLists::LinkedListsException);
+    }
+
+    TEST_F(IntrusiveDoubleLinkedListFixtureClassTest, ObjectInSeveralLists) {
+        EXPECT_EQ(10, allList.size());
+        EXPECT_EQ(5, evenList.size());
+        EXPECT_EQ(&pool[0], &allList.front());
+        EXPECT_EQ(&pool[8], &evenList.back());
+        EXPECT_EQ("4", (++(++evenList.begin()))->name);
+
+        std::stringstream listOutputStream;
+        listOutputStream << evenList;
+        EXPECT_EQ("[0 <---> 2 <---> 4 <---> 6 <---> 8]\n", listOutputStream.str());
+        EXPECT_THROW(allList.push_back(pool[3]), LinkedLists::LinkedListsException);
+    }
+
+    TEST_F(IntrusiveDoubleLinkedListFixtureClassTest, UnlinkByReference) {
+        allList.erase(pool[4]);
+        evenList.erase(pool[4]);
+        EXPECT_EQ(false, pool[4].allHook.is_linked());
+        EXPECT_EQ(true, pool[5].allHook.is_linked());
+        EXPECT_EQ(9, allList.size());
+        EXPECT_EQ(4, evenList.size());
+        EXPECT_EQ(5, (++allList.iterator_to(pool[3]))->value);
+        EXPECT_THROW(allList.erase(pool[4]), LinkedLists::LinkedListsException);
+
+        allList.insert(allList.iterator_to(pool[0]), pool[4]);
+        EXPECT_EQ(4, allList.front().value);
+        allList.erase(allList.begin(), allList.iterator_to(pool[9]));
+        EXPECT_EQ(1, allList.size());
+        EXPECT_EQ(9, allList.front().value);
+        EXPECT_EQ(false, pool[0].allHook.is_linked());
+        // The other hook is not touched
+        EXPECT_EQ(true, pool[0].evenHook.is_linked());
+    }
+
+    TEST_F(IntrusiveDoubleLinkedListFixtureClassTest, MoveSpliceAndClear) {
+        EvenList movedList(std::move(evenList));
+        EXPECT_EQ(true, evenList.empty());
+        EXPECT_EQ(5, movedList.size());
+        EXPECT_EQ(8, (--movedList.end())->value);
+
+        movedList.erase(pool[6]);
+        evenList.push_front(pool[6]);
+        evenList.splice(evenList.end(), movedList);
+        EXPECT_EQ(true, movedList.empty());
+        EXPECT_EQ(5, evenList.size());
+        EXPECT_EQ(6, evenList.front().value);
+        EXPECT_EQ(8, evenList.back().value);
+
+        allList.clear();
+        EXPECT_EQ(true, allList.empty());
+        for (const PooledObject &object : pool) {
+            EXPECT_EQ(false, object.allHook.is_linked());
+        }
+    }
+
+    TEST_F(IntrusiveDoubleLinkedListFixtureClassTest, DestroyedListUnlinksItsObjects) {
+        {
+            EvenList temporaryList;
+            evenList.erase(pool[2]);
+            temporaryList.push_back(pool[2]);
+            temporaryList.splice(temporaryList.end(), evenList);
+            EXPECT_EQ(5, temporaryList.size());
+            EXPECT_EQ(true, evenList.empty());
+        }
+        // The objects outlive the list and may be linked again, the other hook is not touched
+        for (const PooledObject &object : pool) {
+            EXPECT_EQ(false, object.evenHook.is_linked());
+            EXPECT_EQ(true, object.allHook.is_linked());
+        }
+        evenList.push_back(pool[8]);
+        evenList.push_front(pool[2]);
+        EXPECT_EQ(2, evenList.size());
+        EXPECT_EQ(2, evenList.front().value);
+        EXPECT_EQ(10, allList.size());
+
+        // The move assignment unlinks the objects the list held before
+        EvenList oddList;
+        oddList.push_back(pool[1]);
+        oddList.push_back(pool[3]);
+        oddList = std::move(evenList);
+        EXPECT_EQ(false, pool[1].evenHook.is_linked());
+        EXPECT_EQ(false, pool[3].evenHook.is_linked());
+        EXPECT_EQ(true, pool[8].evenHook.is_linked());
+        EXPECT_EQ(8, oddList.back().value);
+    }
+
+}
@@ -0,0 +1,222 @@
+#include "DoubleLinkedList.h"
+#include "ParallelAlgorithms.h"
+#include "XorLinkedList.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    const size_t DEFAULT_ELEMENTS_AMOUNT = 1000000;
+    const size_t TRAVERSALS_AMOUNT = 10;
+
+    /**
+     * @brief Allocator which sums the sizes of the live blocks
+     */
+    template<class T>
+    class FootprintAllocator {
+    public:
+        using value_type = T;
+
+        size_t *liveBytes;
+
+        explicit FootprintAllocator(size_t *bytes) : liveBytes(bytes) {
+        }
+
+        template<class U>
+        FootprintAllocator(const FootprintAllocator<U> &other) : liveBytes(other.liveBytes) {
+        }
+
+        T *allocate(size_t n) {
+            *liveBytes += n * sizeof(T);
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T *pointer, size_t n) {
+            *liveBytes -= n * sizeof(T);
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        template<class U>
+        bool operator==(const FootprintAllocator<U> &other) const {
+            return liveBytes == other.liveBytes;
+        }
+
+        template<class U>
+        bool operator!=(const FootprintAllocator<U> &other) const {
+            return liveBytes != other.liveBytes;
+        }
+    };
+
+    /**
+     * @brief Fills the list, then prints the bytes taken by its nodes and the time of one full traversal
+     *
+     * @tparam List - list of int with FootprintAllocator
+     * @param name - name of the list in the report
+     * @param elementsAmount - number of elements to push
+     */
+    template<template<class, class> class List>
+    void measure(const std::string &name, size_t elementsAmount) {
+        size_t liveBytes = 0;
+        List<int, FootprintAllocator<int>> list((FootprintAllocator<int>(&liveBytes)));
+        for (size_t i = 0; i < elementsAmount; i++) {
+            list.push_back(static_cast<int>(i));
+        }
+
+        long long checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < TRAVERSALS_AMOUNT; i++) {
+            for (int value : list) {
+                checksum += value;
+            }
+        }
+        auto finish = std::chrono::steady_clock::now();
+        double traversalMilliseconds =
+                std::chrono::duration<double, std::milli>(finish - start).count() / TRAVERSALS_AMOUNT;
+
+        std::cout << name << ": " << static_cast<double>(liveBytes) / static_cast<double>(elementsAmount)
+                  << " bytes per element, " << traversalMilliseconds << " ms per traversal"
+                  << " (checksum " << checksum << ")" << std::endl;
+    }
+
+    template<class T, class Allocator>
+    using DoubleLinkedListOf = LinkedLists::DoubleLinkedList<T, Allocator>;
+
+    /**
+     * @brief Runs the scan several times and prints the time of one run
+     *
+     * @param name - name of the scan in the report
+     * @param scan - function which walks the list and returns a checksum
+     */
+    template<class Scan>
+    void measureScan(const std::string &name, Scan scan) {
+        long long checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < TRAVERSALS_AMOUNT; i++) {
+            checksum += scan();
+        }
+        auto finish = std::chrono::steady_clock::now();
+        std::cout << name << ": "
+                  << std::chrono::duration<double, std::milli>(finish - start).count() / TRAVERSALS_AMOUNT
+                  << " ms per traversal (checksum " << checksum << ")" << std::endl;
+    }
+
+    /**
+     * @brief Compares the plain iteration with for_each_prefetched() over a list
+     *        whose neighbouring nodes are scattered over the heap
+     *
+     * @param elementsAmount - number of elements in the list
+     */
+    void measurePrefetchedScan(size_t elementsAmount) {
+        LinkedLists::DoubleLinkedList<int> list;
+        std::vector<LinkedLists::DoubleLinkedList<int>::iterator> positions;
+        for (size_t i = 0; i < elementsAmount; i++) {
+            list.push_back(static_cast<int>(i));
+            positions.push_back(--list.end());
+        }
+        // Relinking the nodes in a random order leaves them in place in memory
+        std::shuffle(positions.begin(), positions.end(), std::mt19937(42));
+        for (auto position : positions) {
+            list.splice(list.end(), list, position);
+        }
+
+        measureScan("Scattered DoubleLinkedList, iterators", [&list] {
+            long long sum = 0;
+            for (int value : list) {
+                sum += value;
+            }
+            return sum;
+        });
+        for (size_t distance : {4, 8, 16}) {
+            list.set_prefetch_distance(distance);
+            measureScan("Scattered DoubleLinkedList, for_each_prefetched, distance " + std::to_string(distance),
+                        [&list] {
+                            long long sum = 0;
+                            list.for_each_prefetched([&sum](int value) {
+                                sum += value;
+                            });
+                            return sum;
+                        });
+        }
+    }
+
+    /**
+     * @brief Compares the serial sum of a list with parallel::transform_reduce() on the shared pool,
+     *        whose segments are found by a walk or by the positional index
+     *
+     * @param elementsAmount - number of elements in the list
+     */
+    void measureParallelReduce(size_t elementsAmount) {
+        LinkedLists::DoubleLinkedList<int> list;
+        for (size_t i = 0; i < elementsAmount; i++) {
+            list.push_back(static_cast<int>(i));
+        }
+        auto parallelSum = [&list] {
+            return LinkedLists::parallel::transform_reduce(list, 0LL, std::plus<long long>(), [](int value) {
+                return static_cast<long long>(value);
+            });
+        };
+        std::string threads = std::to_string(LinkedLists::parallel::ThreadPool::shared().threads()) + " threads";
+
+        measureScan("DoubleLinkedList, serial sum", [&list] {
+            long long sum = 0;
+            for (int value : list) {
+                sum += value;
+            }
+            return sum;
+        });
+        measureScan("DoubleLinkedList, parallel::transform_reduce, " + threads, parallelSum);
+        list.set_positional_index(true);
+        measureScan("DoubleLinkedList, parallel::transform_reduce with positional index, " + threads, parallelSum);
+    }
+
+    /**
+     * @brief Compares the copy constructor with the parallel copy_list() on the shared pool
+     *
+     * @param elementsAmount - number of elements in the list
+     */
+    void measureParallelCopy(size_t elementsAmount) {
+        LinkedLists::DoubleLinkedList<int> list;
+        for (size_t i = 0; i < elementsAmount; i++) {
+            list.push_back(static_cast<int>(i));
+        }
+        auto &pool = LinkedLists::parallel::ThreadPool::shared();
+        measureScan("DoubleLinkedList, copy constructor", [&list] {
+            LinkedLists::DoubleLinkedList<int> copiedList(list);
+            return static_cast<long long>(copiedList.back());
+        });
+        measureScan("DoubleLinkedList, parallel copy_list(), " + std::to_string(pool.threads()) + " threads",
+                    [&list, &pool] {
+                        auto copiedList = LinkedLists::parallel::copy_list(list, pool);
+                        return static_cast<long long>(copiedList.back());
+                    });
+    }
+
+}
+
+/**
+ * @brief Compares the footprint and the traversal speed of DoubleLinkedList and XorLinkedList,
+ *        then the plain and the prefetching scans of a list with scattered nodes
+ *        and the serial and the parallel reductions and copies
+ *        The number of elements may be passed as the first argument
+ */
+int main(int argc, char **argv) {
+    size_t elementsAmount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_ELEMENTS_AMOUNT;
+    if (elementsAmount == 0) {
+        elementsAmount = DEFAULT_ELEMENTS_AMOUNT;
+    }
+    std::cout << "Elements: " << elementsAmount << std::endl;
+    measure<DoubleLinkedListOf>("DoubleLinkedList", elementsAmount);
+    measure<LinkedLists::XorLinkedList>("XorLinkedList", elementsAmount);
+    measurePrefetchedScan(elementsAmount);
+    measureParallelReduce(elementsAmount);
+    measureParallelCopy(elementsAmount);
+    return 0;
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "LinkedListsException.h"
+#include "gtest/gtest.h"
+
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <utility>
+
+namespace googleTests {
+
+    const static size_t HARNESS_RANDOM_OPERATIONS_AMOUNT = 2000;
+
+    /**
+     * @brief Compares the list with the reference walking forward and then backward,
+     *        so the links of both directions are checked
+     *
+     * @param list - list of int to check
+     * @param reference - expected elements
+     * @return true, if the list holds the elements of the reference in the same order
+     */
+    template<class List>
+    bool isEqualToReference(const List &list, const std::list<int> &reference) {
+        if (list.size() != reference.size()) {
+            return false;
+        }
+        auto referenceIterator = reference.begin();
+        for (auto current = list.cbegin(); current != list.cend(); ++current, ++referenceIterator) {
+            if (*current != *referenceIterator) {
+                return false;
+            }
+        }
+        auto reverseReferenceIterator = reference.rbegin();
+        for (auto current = list.cend(); current != list.cbegin(); ++reverseReferenceIterator) {
+            if (*(--current) != *reverseReferenceIterator) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks of the interface which every list of int shares with DoubleLinkedList,
+     *        the list is compared with std::list on the same operations
+     *        A test file runs them for its list by INSTANTIATE_TYPED_TEST_SUITE_P
+     *
+     * @tparam List - list of int
+     */
+    template<class List>
+    class ListReferenceFixtureClassTest : public ::testing::Test {
+    protected:
+
+        void SetUp() override {
+            for (int i = 0; i < 10; i++) {
+                nonEmptyList.push_back(i);
+            }
+        }
+
+        List emptyList;
+        List nonEmptyList;
+    };
+
+    TYPED_TEST_SUITE_P(ListReferenceFixtureClassTest);
+
+    TYPED_TEST_P(ListReferenceFixtureClassTest, IsEmpty) {
+        EXPECT_EQ(true, this->emptyList.empty());
+        EXPECT_EQ(0, this->emptyList.size());
+        EXPECT_EQ(true, this->emptyList.begin() == this->emptyList.end());
+        EXPECT_THROW(this->emptyList.front(), LinkedLists::LinkedListsException);
+        EXPECT_THROW(this->emptyList.back(), LinkedLists::LinkedListsException);
+        EXPECT_THROW(this->emptyList.erase(this->emptyList.end()), LinkedLists::LinkedListsException);
+    }
+
+    TYPED_TEST_P(ListReferenceFixtureClassTest, PushAndPopAtBothEnds) {
+        this->emptyList.push_back(1);
+        this->emptyList.push_front(0);
+        this->emptyList.emplace_back(2);
+        EXPECT_EQ(0, this->emptyList.front());
+        EXPECT_EQ(2, this->emptyList.back());
+        EXPECT_EQ(1, *(this->emptyList.begin() + 1));
+        EXPECT_EQ(1, *(--(--this->emptyList.end())));
+        this->emptyList.pop_back();
+        this->emptyList.pop_front();
+        EXPECT_EQ(1, this->emptyList.front());
+        EXPECT_EQ(1, this->emptyList.back());
+        this->emptyList.pop_back();
+        EXPECT_EQ(true, this->emptyList.empty());
+        EXPECT_EQ(true, this->emptyList.begin() == this->emptyList.end());
+    }
+
+    TYPED_TEST_P(ListReferenceFixtureClassTest, SignedShifts) {
+        const TypeParam &constList = this->nonEmptyList;
+        for (std::ptrdiff_t shift = 1; shift <= 10; shift++) {
+            EXPECT_EQ(10 - shift, *(this->nonEmptyList.end() + (-shift)));
+            EXPECT_EQ(10 - shift, *(this->nonEmptyList.end() - shift));
+            EXPECT_EQ(10 - shift, *(-shift + constList.end()));
+            EXPECT_EQ(10 - shift, *(constList.end() - shift));
+            EXPECT_EQ(shift - 1, *(constList.begin() + (shift - 1)));
+        }
+        auto sixth = this->nonEmptyList.begin() + 6;
+        EXPECT_EQ(1, *(sixth - 5));
+        EXPECT_EQ(true, sixth - 6 == this->nonEmptyList.begin());
+        EXPECT_EQ(true, sixth + 4 == this->nonEmptyList.end());
+        EXPECT_EQ(true, (sixth - 2) + 2 == sixth);
+
+        auto constSixth = constList.cbegin() + 6;
+        EXPECT_EQ(3, *(constSixth + (-3)));
+        EXPECT_EQ(true, constSixth - 6 == constList.cbegin());
+        EXPECT_EQ(true, 4 + constSixth == constList.cend());
+    }
+
+    TYPED_TEST_P(ListReferenceFixtureClassTest, RandomOperationsMatchStdList) {
+        std::mt19937 generator(42);
+        std::list<int> reference;
+        for (size_t i = 0; i < HARNESS_RANDOM_OPERATIONS_AMOUNT; i++) {
+            int position = reference.empty() ? 0 : static_cast<int>(generator() % (reference.size() + 1));
+            if (generator() % 3 != 0 || reference.empty()) {
+                auto inserted = this->emptyList.insert(this->emptyList.begin() + position, static_cast<int>(i));
+                reference.insert(std::next(reference.begin(), position), static_cast<int>(i));
+                EXPECT_EQ(static_cast<int>(i), *inserted);
+            } else {
+                position %= static_cast<int>(reference.size());
+                auto next = this->emptyList.erase(this->emptyList.begin() + position);
+                auto referenceNext = reference.erase(std::next(reference.begin(), position));
+                EXPECT_EQ(referenceNext == reference.end(), next == this->emptyList.end());
+                if (referenceNext != reference.end()) {
+                    EXPECT_EQ(*referenceNext, *next);
+                }
+            }
+        }
+        EXPECT_EQ(true, isEqualToReference(this->emptyList, reference));
+    }
+
+    TYPED_TEST_P(ListReferenceFixtureClassTest, CopyMoveAndCompare) {
+        TypeParam copiedList(this->nonEmptyList);
+        EXPECT_EQ(true, copiedList == this->nonEmptyList);
+        copiedList.back() = -1;
+        EXPECT_EQ(true, copiedList != this->nonEmptyList);
+
+        TypeParam movedList(std::move(copiedList));
+        EXPECT_EQ(true, copiedList.empty());
+        EXPECT_EQ(-1, movedList.back());
+        EXPECT_EQ(-1, *(--movedList.end()));
+
+        copiedList = this->nonEmptyList;
+        EXPECT_EQ(true, copiedList == this->nonEmptyList);
+        movedList = std::move(copiedList);
+        EXPECT_EQ(true, movedList == this->nonEmptyList);
+    }
+
+    TYPED_TEST_P(ListReferenceFixtureClassTest, PrintList) {
+        std::stringstream listOutputStream;
+        listOutputStream << this->nonEmptyList << this->emptyList;
+        EXPECT_EQ("[0 <---> 1 <---> 2 <---> 3 <---> 4 <---> 5 <---> 6 <---> 7 <---> 8 <---> 9]\n[]\n",
+                  listOutputStream.str());
+    }
+
+    REGISTER_TYPED_TEST_SUITE_P(ListReferenceFixtureClassTest, IsEmpty, PushAndPopAtBothEnds, SignedShifts,
+                                RandomOperationsMatchStdList, CopyMoveAndCompare, PrintList);
+
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "DoubleLinkedList.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace LinkedLists {
+
+    /**
+     * @class NodeArena
+     *
+     * @brief Hands out memory for list nodes from large slabs
+     *        Single deallocations are ignored, the memory of all slabs
+     *        is returned at once by release() or by the destructor
+     *
+     *        The arena is not thread safe and must outlive every list bound to it
+     *
+     * @author Andrey Valitov
+     *
+     * @version 1.0
+     */
+    class NodeArena {
+    private:
+
+        struct Slab {
+            Slab *next;
+        };
+
+        static constexpr size_t DEFAULT_SLAB_SIZE = 64 * 1024;
+
+        Slab *slabs_ = nullptr;
+
+        char *currentPosition_ = nullptr;
+
+        char *currentEnd_ = nullptr;
+
+        size_t slabSize_;
+
+        size_t slabsCount_ = 0;
+
+        /**
+         * @brief Allocates a new slab and makes it current
+         *
+         * @param minimalSize - number of bytes the slab has to fit besides its header
+         */
+        void addSlab(size_t minimalSize) {
+            size_t payloadSize = minimalSize > slabSize_ ? minimalSize : slabSize_;
+            auto *slab = static_cast<Slab *>(::operator new(sizeof(Slab) + payloadSize));
+            slab->next = slabs_;
+            slabs_ = slab;
+            ++slabsCount_;
+            currentPosition_ = reinterpret_cast<char *>(slab + 1);
+            currentEnd_ = currentPosition_ + payloadSize;
+        };
+
+    public:
+
+        /**
+         * @brief Constructor - empty arena, no memory is allocated until the first request
+         *
+         * @param slabSize - number of bytes in one slab
+         */
+        explicit NodeArena(size_t slabSize = DEFAULT_SLAB_SIZE) : slabSize_(slabSize) {
+        };
+
+        NodeArena(const NodeArena &other) = delete;
+
+        NodeArena &operator=(const NodeArena &other) = delete;
+
+        /**
+         * @brief Destructor
+         *        Returns all slabs to the system
+         */
+        ~NodeArena() {
+            release();
+        };
+
+        /**
+         * @brief Takes the memory block from the current slab, a new slab is started if it does not fit
+         *
+         * @param bytes - size of the block
+         * @param alignment - alignment of the block, power of two
+         * @return pointer to the block
+         */
+        void *allocate(size_t bytes, size_t alignment) {
+            auto position = reinterpret_cast<std::uintptr_t>(currentPosition_);
+            auto aligned = (position + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            if (currentPosition_ == nullptr || aligned + bytes > reinterpret_cast<std::uintptr_t>(currentEnd_)) {
+                addSlab(bytes + alignment);
+                position = reinterpret_cast<std::uintptr_t>(currentPosition_);
+                aligned = (position + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            }
+            currentPosition_ = reinterpret_cast<char *>(aligned + bytes);
+            return reinterpret_cast<void *>(aligned);
+        };
+
+        /**
+         * @brief Makes sure that the next allocations of total size bytes are taken from one slab
+         *
+         * @param bytes - total size of the next allocations including alignment padding
+         */
+        void reserve(size_t bytes) {
+            if (currentPosition_ == nullptr || currentPosition_ + bytes > currentEnd_) {
+                addSlab(bytes);
+            }
+        };
+
+        /**
+         * @brief Returns all slabs to the system at once
+         *        All memory handed out by the arena becomes invalid
+         */
+        void release() {
+            while (slabs_ != nullptr) {
+                Slab *next = slabs_->next;
+                ::operator delete(slabs_);
+                slabs_ = next;
+            }
+            slabsCount_ = 0;
+            currentPosition_ = nullptr;
+            currentEnd_ = nullptr;
+        };
+
+        /**
+         * @return number of slabs allocated by the arena
+         */
+        [[nodiscard]] size_t slabs_count() const {
+            return slabsCount_;
+        };
+    };
+
+    /**
+     * @class ArenaAllocator
+     *
+     * @brief Allocator which takes memory from NodeArena
+     *        Its deallocate does nothing, so the lists using it
+     *        may drop trivially destructible elements without visiting them
+     *
+     * @tparam T
+     */
+    template<class T>
+    class ArenaAllocator {
+    private:
+
+        template<class U>
+        friend class ArenaAllocator;
+
+        NodeArena *arena_;
+    public:
+
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        // Memory is reclaimed by NodeArena::release(), see AllocatorReleasesInBulk
+        using is_bulk_released = std::true_type;
+
+        ArenaAllocator(NodeArena &arena) noexcept: arena_(&arena) {
+        };
+
+        template<class U>
+        ArenaAllocator(const ArenaAllocator<U> &other) noexcept : arena_(other.arena_) {
+        };
+
+        T *allocate(size_t n) {
+            return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+        };
+
+        void deallocate(T *, size_t) noexcept {
+        };
+
+        /**
+         * @brief Prepares contiguous memory for the next n single allocations
+         *
+         * @param n - number of objects
+         */
+        void reserve(size_t n) {
+            arena_->reserve(n * sizeof(T) + alignof(T));
+        };
+
+        /**
+         * @return arena the allocator takes memory from
+         */
+        [[nodiscard]] NodeArena &arena() const noexcept {
+            return *arena_;
+        };
+
+        template<class U>
+        bool operator==(const ArenaAllocator<U> &other) const noexcept {
+            return arena_ == other.arena_;
+        };
+
+        template<class U>
+        bool operator!=(const ArenaAllocator<U> &other) const noexcept {
+            return arena_ != other.arena_;
+        };
+    };
+
+    /**
+     * @brief List which takes its nodes from NodeArena
+     *        For trivially destructible T clear() and the destructor take O(1)
+     */
+    template<class T>
+    using ArenaDoubleLinkedList = DoubleLinkedList<T, ArenaAllocator<T>>;
+
+}
@@ -0,0 +1,471 @@
+#pragma once
+
+#include "DoubleLinkedList.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LinkedLists {
+
+    namespace parallel {
+
+        // Lists shorter than two such segments are handled on the calling thread
+        const static size_t DEFAULT_MINIMAL_SEGMENT_LENGTH = 16 * 1024;
+
+        // Segments per thread, the extra ones even out the threads which run slower
+        const static size_t SEGMENTS_PER_THREAD = 4;
+
+        /**
+         * @class ThreadPool
+         *
+         * @brief Fixed set of worker threads which run the segments of the parallel algorithms
+         *        The calling thread takes segments as well, so run() makes progress even when
+         *        all workers are busy, and it may be called from inside a running segment
+         *
+         * @author Andrey Valitov
+         *
+         * @version 1.0
+         */
+        class ThreadPool {
+        private:
+
+            /*
+             * State of one run() call, the queued helpers keep it alive after the call returns
+             * A helper calls the body only after it claimed a segment, which is impossible
+             * once all segments are done and run() has returned
+             */
+            struct Run {
+                std::function<void(size_t)> body;
+                size_t count;
+                std::atomic<size_t> next{0};
+                std::mutex mutex;
+                std::condition_variable finished;
+                size_t completed = 0;
+                std::vector<std::exception_ptr> errors;
+            };
+
+            std::vector<std::thread> workers_;
+
+            std::deque<std::function<void()>> tasks_;
+
+            std::mutex mutex_;
+
+            std::condition_variable wakeUp_;
+
+            bool stopping_ = false;
+
+            /**
+             * @brief Takes the segments of the run until none are left
+             *
+             * @param run - state of the run
+             */
+            static void takeSegments(Run &run) {
+                for (size_t segment = run.next++; segment < run.count; segment = run.next++) {
+                    std::exception_ptr error;
+                    try {
+                        run.body(segment);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                    std::lock_guard<std::mutex> lock(run.mutex);
+                    run.errors[segment] = error;
+                    if (++run.completed == run.count) {
+                        run.finished.notify_all();
+                    }
+                }
+            };
+
+            void work() {
+                while (true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        wakeUp_.wait(lock, [this] {
+                            return stopping_ || !tasks_.empty();
+                        });
+                        if (tasks_.empty()) {
+                            return;
+                        }
+                        task = std::move(tasks_.front());
+                        tasks_.pop_front();
+                    }
+                    task();
+                }
+            };
+
+        public:
+
+            /**
+             * @brief Constructor - starts the worker threads
+             *
+             * @param workersAmount - number of threads besides the calling one
+             */
+            explicit ThreadPool(size_t workersAmount) {
+                workers_.reserve(workersAmount);
+                for (size_t i = 0; i < workersAmount; i++) {
+                    workers_.emplace_back([this] {
+                        work();
+                    });
+                }
+            };
+
+            ThreadPool(const ThreadPool &other) = delete;
+
+            ThreadPool &operator=(const ThreadPool &other) = delete;
+
+            /**
+             * @brief Destructor
+             *        Finishes the queued tasks and joins the workers
+             */
+            ~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stopping_ = true;
+                }
+                wakeUp_.notify_all();
+                for (std::thread &worker : workers_) {
+                    worker.join();
+                }
+            };
+
+            /**
+             * @return pool with a worker per hardware thread besides the calling one
+             */
+            static ThreadPool &shared() {
+                static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+                return pool;
+            };
+
+            /**
+             * @return number of threads which run the segments, the calling one included
+             */
+            [[nodiscard]] size_t threads() const {
+                return workers_.size() + 1;
+            };
+
+            /**
+             * @brief Calls body(segment) for every segment from 0 to count (not include)
+             *        on the workers and the calling thread and waits for all of them
+             *        If some calls throw, the exception of the first such segment is rethrown
+             *
+             * @param count - number of segments
+             * @param body - function of the segment number
+             */
+            template<class Body>
+            void run(size_t count, Body &&body) {
+                if (count == 0) {
+                    return;
+                }
+                auto run = std::make_shared<Run>();
+                run->body = [&body](size_t segment) {
+                    body(segment);
+                };
+                run->count = count;
+                run->errors.resize(count);
+
+                size_t helpersAmount = std::min(workers_.size(), count - 1);
+                if (helpersAmount > 0) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        for (size_t i = 0; i < helpersAmount; i++) {
+                            tasks_.emplace_back([run] {
+                                takeSegments(*run);
+                            });
+                        }
+                    }
+                    wakeUp_.notify_all();
+                }
+                takeSegments(*run);
+                {
+                    std::unique_lock<std::mutex> lock(run->mutex);
+                    run->finished.wait(lock, [&run] {
+                        return run->completed == run->count;
+                    });
+                }
+                for (const std::exception_ptr &error : run->errors) {
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+            };
+        };
+
+        /**
+         * @param size - number of elements
+         * @param segments - number of segments of nearly equal length
+         * @param segment - number of the segment, segments gives size
+         * @return position of the first element of the segment
+         */
+        inline size_t segmentStart(size_t size, size_t segments, size_t segment) {
+            return size / segments * segment + std::min(segment, size % segments);
+        };
+
+        template<class Container, class = void>
+        struct HasPositionalIndex : std::false_type {
+        };
+
+        template<class Container>
+        struct HasPositionalIndex<Container, std::void_t<
+                decltype(std::declval<Container &>().has_positional_index()),
+                decltype(std::declval<Container &>().iterator_at(size_t()))>> : std::true_type {
+        };
+
+        /**
+         * @brief Finds the boundaries of segments of nearly equal length
+         *        A non-const list with the enabled positional index is split by iterator_at() in O(segments * log n),
+         *        otherwise by one walk which only follows the links
+         *
+         * @param container - container to split
+         * @param segments - number of segments
+         * @return segments + 1 iterators, the segment i is from the i-th to the (i + 1)-th one
+         */
+        template<class Container>
+        auto splitIntoSegments(Container &container, size_t segments) {
+            using Iterator = decltype(std::begin(container));
+            size_t size = container.size();
+            std::vector<Iterator> boundaries;
+            boundaries.reserve(segments + 1);
+            // The const lists do not rebuild a stale index, they would walk from the ends for every boundary
+            if constexpr (HasPositionalIndex<Container>::value && !std::is_const_v<Container>) {
+                if (container.has_positional_index()) {
+                    for (size_t i = 0; i <= segments; i++) {
+                        boundaries.push_back(container.iterator_at(segmentStart(size, segments, i)));
+                    }
+                    return boundaries;
+                }
+            }
+            Iterator current = std::begin(container);
+            boundaries.push_back(current);
+            for (size_t i = 0; i < segments; i++) {
+                size_t length = segmentStart(size, segments, i + 1) - segmentStart(size, segments, i);
+                for (size_t j = 0; j < length; j++) {
+                    ++current;
+                }
+                boundaries.push_back(current);
+            }
+            return boundaries;
+        };
+
+        /**
+         * @param size - number of elements
+         * @param threads - number of threads of the pool
+         * @param minimalSegmentLength - minimal number of elements in a segment
+         * @return number of segments the elements are split into, 1 means the serial run
+         */
+        inline size_t segmentsFor(size_t size, size_t threads, size_t minimalSegmentLength) {
+            if (threads == 1 || size < 2 * std::max<size_t>(minimalSegmentLength, 1)) {
+                return 1;
+            }
+            return std::min(threads * SEGMENTS_PER_THREAD, size / std::max<size_t>(minimalSegmentLength, 1));
+        };
+
+        /**
+         * @brief Calls function for every element of the container, segments of the container
+         *        are handled concurrently by the thread pool
+         *        function must be safe to call concurrently for different elements
+         *
+         * @param container - container to walk, for example a DoubleLinkedList
+         * @param function - function called once for every element
+         * @param pool - threads which handle the segments
+         * @param minimalSegmentLength - minimal number of elements handled by one task
+         */
+        template<class Container, class Function>
+        void for_each(Container &container, Function function, ThreadPool &pool = ThreadPool::shared(),
+                      size_t minimalSegmentLength = DEFAULT_MINIMAL_SEGMENT_LENGTH) {
+            size_t segments = segmentsFor(container.size(), pool.threads(), minimalSegmentLength);
+            if (segments == 1) {
+                std::for_each(std::begin(container), std::end(container), function);
+                return;
+            }
+            auto boundaries = splitIntoSegments(container, segments);
+            pool.run(segments, [&boundaries, &function](size_t segment) {
+                std::for_each(boundaries[segment], boundaries[segment + 1], function);
+            });
+        };
+
+        /**
+         * @brief Transforms every element and reduces the results, segments of the container
+         *        are handled concurrently by the thread pool
+         *        The partial results of the segments are reduced in the list order from init,
+         *        so the result does not depend on the thread timing
+         *
+         * @param container - container to walk, for example a DoubleLinkedList
+         * @param init - initial value of the reduction
+         * @param reduce - associative binary operation
+         * @param transform - function of an element, called concurrently for different elements
+         * @param pool - threads which handle the segments
+         * @param minimalSegmentLength - minimal number of elements handled by one task
+         * @return reduced value
+         */
+        template<class Container, class Value, class Reduce, class Transform>
+        Value transform_reduce(Container &container, Value init, Reduce reduce, Transform transform,
+                               ThreadPool &pool = ThreadPool::shared(),
+                               size_t minimalSegmentLength = DEFAULT_MINIMAL_SEGMENT_LENGTH) {
+            size_t segments = segmentsFor(container.size(), pool.threads(), minimalSegmentLength);
+            if (segments == 1) {
+                for (auto &&element : container) {
+                    init = reduce(std::move(init), transform(element));
+                }
+                return init;
+            }
+            auto boundaries = splitIntoSegments(container, segments);
+            // Every segment is not empty, its partial result starts from its first element
+            std::vector<std::unique_ptr<Value>> partials(segments);
+            pool.run(segments, [&](size_t segment) {
+                auto current = boundaries[segment];
+                Value partial = transform(*current);
+                for (++current; current != boundaries[segment + 1]; ++current) {
+                    partial = reduce(std::move(partial), transform(*current));
+                }
+                partials[segment] = std::make_unique<Value>(std::move(partial));
+            });
+            for (std::unique_ptr<Value> &partial : partials) {
+                init = reduce(std::move(init), std::move(*partial));
+            }
+            return init;
+        };
+
+        /**
+         * @brief Counts the elements for which predicate returns true,
+         *        segments of the container are handled concurrently by the thread pool
+         *
+         * @param container - container to walk, for example a DoubleLinkedList
+         * @param predicate - function of an element, called concurrently for different elements
+         * @param pool - threads which handle the segments
+         * @param minimalSegmentLength - minimal number of elements handled by one task
+         * @return number of elements
+         */
+        template<class Container, class Predicate>
+        size_t count_if(Container &container, Predicate predicate, ThreadPool &pool = ThreadPool::shared(),
+                        size_t minimalSegmentLength = DEFAULT_MINIMAL_SEGMENT_LENGTH) {
+            return transform_reduce(container, size_t(0), std::plus<size_t>(), [&predicate](const auto &element) {
+                return predicate(element) ? size_t(1) : size_t(0);
+            }, pool, minimalSegmentLength);
+        };
+
+        /**
+         * @class ListConstruction
+         *
+         * @brief Copies the segments of a source into a DoubleLinkedList on the pool threads
+         *        and stitches the copies together, see copy_list() and make_list()
+         *
+         * @author Andrey Valitov
+         *
+         * @version 1.0
+         */
+        class ListConstruction {
+        public:
+
+            /**
+             * @return true, if copies of the node allocator of List may allocate concurrently
+             */
+            template<class List>
+            static constexpr bool isParallel() {
+                return AllocatorIsThreadSafe<typename List::NodeAllocator>::value;
+            };
+
+            /**
+             * @brief Appends copies of the segments to the end of the list,
+             *        the segments are copied on the pool threads
+             *        If a copy throws, all new nodes are destroyed and the list is not changed
+             *
+             * @param list - list with a thread safe allocator
+             * @param boundaries - segments + 1 iterators of the source,
+             *                     the segment i is from the i-th to the (i + 1)-th one
+             * @param count - number of elements in all segments
+             * @param pool - threads which copy the segments
+             */
+            template<class List, class Iterator>
+            static void appendSegments(List &list, const std::vector<Iterator> &boundaries, size_t count,
+                                       ThreadPool &pool) {
+                static_assert(isParallel<List>(), "the parallel copy needs an allocator which declares is_thread_safe");
+                list.appendSegments(boundaries, count, [&pool](size_t segments, auto &&body) {
+                    pool.run(segments, body);
+                });
+            };
+        };
+
+        /**
+         * @brief Parallel copy of a list
+         *        source is split into segments by one walk, the segments are copied into chains
+         *        of new nodes on the pool threads, and the chains are stitched together at the boundaries,
+         *        so the allocation and the copying of a large list are spread over the cores
+         *        Lists shorter than two segments and allocators which are not thread safe
+         *        (see AllocatorIsThreadSafe) are copied on the calling thread
+         *        T must be safe to copy concurrently from different elements
+         *        A large sum is built as copy_list(left, pool) += copy_list(right, pool)
+         *
+         * @param source - list to copy
+         * @param pool - threads which copy the segments
+         * @param minimalSegmentLength - minimal number of elements copied by one task
+         * @return copy of source with the allocator of the copy constructor
+         */
+        template<class T, class Allocator, class NodeLayout>
+        DoubleLinkedList<T, Allocator, NodeLayout> copy_list(const DoubleLinkedList<T, Allocator, NodeLayout> &source,
+                                                             ThreadPool &pool = ThreadPool::shared(),
+                                                             size_t minimalSegmentLength = DEFAULT_MINIMAL_SEGMENT_LENGTH) {
+            using List = DoubleLinkedList<T, Allocator, NodeLayout>;
+            if constexpr (ListConstruction::isParallel<List>()) {
+                size_t segments = segmentsFor(source.size(), pool.threads(), minimalSegmentLength);
+                if (segments > 1) {
+                    List copy(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                            source.get_allocator()));
+                    ListConstruction::appendSegments(copy, splitIntoSegments(source, segments), source.size(), pool);
+                    return copy;
+                }
+            }
+            return List(source);
+        };
+
+        /**
+         * @brief Parallel construction of a list from a range
+         *        The range is split into segments in O(1), they are copied on the pool threads as in copy_list()
+         *
+         * @tparam List - DoubleLinkedList to build
+         * @param first - random access iterator to the first element to copy
+         * @param last - iterator to the element after the last one to copy
+         * @param pool - threads which copy the segments
+         * @param minimalSegmentLength - minimal number of elements copied by one task
+         * @param allocator - allocator of the new list
+         * @return list with the elements of the range
+         */
+        template<class List, class RandomAccessIterator>
+        List make_list(RandomAccessIterator first, RandomAccessIterator last, ThreadPool &pool = ThreadPool::shared(),
+                       size_t minimalSegmentLength = DEFAULT_MINIMAL_SEGMENT_LENGTH,
+                       const typename List::allocator_type &allocator = typename List::allocator_type()) {
+            static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<RandomAccessIterator>::iterator_category>,
+                          "make_list() splits the range in O(1), it needs random access iterators");
+            size_t count = static_cast<size_t>(last - first);
+            List list(allocator);
+            if constexpr (ListConstruction::isParallel<List>()) {
+                size_t segments = segmentsFor(count, pool.threads(), minimalSegmentLength);
+                if (segments > 1) {
+                    std::vector<RandomAccessIterator> boundaries;
+                    boundaries.reserve(segments + 1);
+                    for (size_t i = 0; i <= segments; i++) {
+                        boundaries.push_back(first + static_cast<std::ptrdiff_t>(segmentStart(count, segments, i)));
+                    }
+                    ListConstruction::appendSegments(list, boundaries, count, pool);
+                    return list;
+                }
+            }
+            list.assign(first, last);
+            return list;
+        };
+
+    }
+
+}
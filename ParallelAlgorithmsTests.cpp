@@ -0,0 +1,223 @@
+#include "ParallelAlgorithms.h"
+#include "DoubleLinkedList.h"
+#include "XorLinkedList.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace googleTests {
+
+    const static size_t PARALLEL_ELEMENTS_AMOUNT = 10000;
+
+    /**
+     * @brief Thread safe allocator which counts the live blocks
+     */
+    template<class T>
+    class AtomicCountingAllocator {
+    public:
+        using value_type = T;
+        using is_thread_safe = std::true_type;
+
+        std::atomic<long> *liveBlocks;
+
+        explicit AtomicCountingAllocator(std::atomic<long> *blocks) : liveBlocks(blocks) {
+        }
+
+        template<class U>
+        AtomicCountingAllocator(const AtomicCountingAllocator<U> &other) : liveBlocks(other.liveBlocks) {
+        }
+
+        T *allocate(size_t n) {
+            ++*liveBlocks;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T *pointer, size_t n) {
+            --*liveBlocks;
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        template<class U>
+        bool operator==(const AtomicCountingAllocator<U> &other) const {
+            return liveBlocks == other.liveBlocks;
+        }
+
+        template<class U>
+        bool operator!=(const AtomicCountingAllocator<U> &other) const {
+            return liveBlocks != other.liveBlocks;
+        }
+    };
+
+    /**
+     * @brief Element whose copy throws for the chosen value
+     */
+    struct ThrowingCopy {
+        int value;
+
+        explicit ThrowingCopy(int value) : value(value) {
+        }
+
+        ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+            if (value == 777) {
+                throw std::runtime_error("failure in copy");
+            }
+        }
+
+        ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+    };
+
+    class ParallelAlgorithmsFixtureClassTest : public ::testing::Test {
+    protected:
+
+        void SetUp() override {
+            for (size_t i = 0; i < PARALLEL_ELEMENTS_AMOUNT; i++) {
+                list.push_back(static_cast<long long>(i));
+            }
+        }
+
+        // The pool has its own workers even on a single core host
+        LinkedLists::parallel::ThreadPool pool{3};
+        LinkedLists::DoubleLinkedList<long long> list;
+    };
+
+    TEST_F(ParallelAlgorithmsFixtureClassTest, ForEachVisitsEveryElementOnce) {
+        LinkedLists::parallel::for_each(list, [](long long &value) {
+            value *= 2;
+        }, pool, 100);
+        long long expected = 0;
+        for (long long value : list) {
+            EXPECT_EQ(expected, value);
+            expected += 2;
+        }
+
+        list.set_positional_index(true);
+        LinkedLists::parallel::for_each(list, [](long long &value) {
+            value /= 2;
+        }, pool, 7);
+        EXPECT_EQ(static_cast<long long>(PARALLEL_ELEMENTS_AMOUNT - 1), list.back());
+        EXPECT_EQ(1, list.at(1));
+    }
+
+    TEST_F(ParallelAlgorithmsFixtureClassTest, ReductionOrderIsDeterministic) {
+        long long sum = LinkedLists::parallel::transform_reduce(list, 0LL, std::plus<long long>(), [](long long value) {
+            return value * value;
+        }, pool, 1);
+        long long expectedSum = 0;
+        for (long long value : list) {
+            expectedSum += value * value;
+        }
+        EXPECT_EQ(expectedSum, sum);
+
+        // Concatenation is not commutative, the partial results are joined in the list order
+        LinkedLists::DoubleLinkedList<std::string> words;
+        std::string expectedText = ">";
+        for (int i = 0; i < 200; i++) {
+            words.push_back(std::to_string(i));
+            expectedText += std::to_string(i) + ",";
+        }
+        const LinkedLists::DoubleLinkedList<std::string> &constWords = words;
+        for (size_t minimalSegmentLength : {1, 3, 64, 1000}) {
+            EXPECT_EQ(expectedText, LinkedLists::parallel::transform_reduce(
+                    constWords, std::string(">"), std::plus<std::string>(), [](const std::string &word) {
+                        return word + ",";
+                    }, pool, minimalSegmentLength));
+        }
+
+        LinkedLists::DoubleLinkedList<long long> emptyList;
+        EXPECT_EQ(5, LinkedLists::parallel::transform_reduce(emptyList, 5LL, std::plus<long long>(), [](long long value) {
+            return value;
+        }, pool, 1));
+    }
+
+    TEST_F(ParallelAlgorithmsFixtureClassTest, CountIfAndOtherContainers) {
+        EXPECT_EQ(PARALLEL_ELEMENTS_AMOUNT / 3 + 1, LinkedLists::parallel::count_if(list, [](long long value) {
+            return value % 3 == 0;
+        }, pool, 10));
+
+        LinkedLists::XorLinkedList<int> xorList;
+        for (int i = 0; i < 1000; i++) {
+            xorList.push_back(i);
+        }
+        EXPECT_EQ(500, LinkedLists::parallel::count_if(xorList, [](int value) {
+            return value % 2 == 1;
+        }, pool, 10));
+        // The shared pool handles the short lists on the calling thread
+        EXPECT_EQ(1000, LinkedLists::parallel::count_if(xorList, [](int value) {
+            return value >= 0;
+        }));
+    }
+
+    TEST_F(ParallelAlgorithmsFixtureClassTest, ExceptionOfSegmentIsRethrown) {
+        EXPECT_THROW(LinkedLists::parallel::for_each(list, [](long long value) {
+            if (value % 1000 == 999) {
+                throw std::runtime_error("failure in segment");
+            }
+        }, pool, 10), std::runtime_error);
+        // The pool stays usable
+        EXPECT_EQ(PARALLEL_ELEMENTS_AMOUNT, LinkedLists::parallel::count_if(list, [](long long value) {
+            return value >= 0;
+        }, pool, 10));
+    }
+
+    TEST_F(ParallelAlgorithmsFixtureClassTest, ParallelCopyAndRangeConstruction) {
+        auto copiedList = LinkedLists::parallel::copy_list(list, pool, 100);
+        EXPECT_EQ(true, copiedList == list);
+        EXPECT_EQ(list.back(), *(--copiedList.end()));
+        copiedList.pop_front();
+        EXPECT_EQ(1, copiedList.front());
+
+        std::vector<std::string> words;
+        for (int i = 0; i < 1000; i++) {
+            words.push_back(std::to_string(i));
+        }
+        using WordsList = LinkedLists::DoubleLinkedList<std::string, std::allocator<std::string>,
+                LinkedLists::SplitNodeLayout>;
+        auto wordsList = LinkedLists::parallel::make_list<WordsList>(words.begin(), words.end(), pool, 10);
+        EXPECT_EQ(words.size(), wordsList.size());
+        size_t position = 0;
+        for (const std::string &word : wordsList) {
+            EXPECT_EQ(words[position++], word);
+        }
+        EXPECT_EQ("999", *(--wordsList.end()));
+
+        // The sum of two large lists is built from parallel copies without copying twice
+        auto sumList = LinkedLists::parallel::copy_list(list, pool, 100);
+        sumList += LinkedLists::parallel::copy_list(copiedList, pool, 100);
+        EXPECT_EQ(2 * PARALLEL_ELEMENTS_AMOUNT - 1, sumList.size());
+        EXPECT_EQ(true, sumList == list + copiedList);
+
+        std::vector<long long> noNumbers;
+        auto emptyList = LinkedLists::parallel::make_list<LinkedLists::DoubleLinkedList<long long>>(
+                noNumbers.begin(), noNumbers.end(), pool, 1);
+        EXPECT_EQ(true, emptyList.empty());
+    }
+
+    TEST_F(ParallelAlgorithmsFixtureClassTest, ParallelCopyReleasesNodesOnException) {
+        std::atomic<long> liveBlocks(0);
+        std::vector<ThrowingCopy> elements;
+        for (int i = 0; i < 1000; i++) {
+            elements.emplace_back(i);
+        }
+        using ThrowingList = LinkedLists::DoubleLinkedList<ThrowingCopy, AtomicCountingAllocator<ThrowingCopy>>;
+        EXPECT_THROW(LinkedLists::parallel::make_list<ThrowingList>(elements.begin(), elements.end(), pool, 10,
+                AtomicCountingAllocator<ThrowingCopy>(&liveBlocks)), std::runtime_error);
+        EXPECT_EQ(0, liveBlocks.load());
+
+        elements[777].value = 0;
+        {
+            auto throwingList = LinkedLists::parallel::make_list<ThrowingList>(elements.begin(), elements.end(), pool, 10,
+                    AtomicCountingAllocator<ThrowingCopy>(&liveBlocks));
+            EXPECT_EQ(1000, liveBlocks.load());
+            throwingList.back().value = 777;
+            EXPECT_THROW(LinkedLists::parallel::copy_list(throwingList, pool, 10), std::runtime_error);
+            EXPECT_EQ(1000, liveBlocks.load());
+        }
+        EXPECT_EQ(0, liveBlocks.load());
+    }
+
+}
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace LinkedLists {
+
+    /**
+     * @class PositionalIndex
+     *
+     * @brief Order-statistic index of a sequence of distinct keys
+     *        The keys are kept in an implicit treap: every entry knows the size of its subtree,
+     *        so the key at a position and the position of a key are found in O(log n) expected time
+     *        The entries live in one pool and refer to each other by indices,
+     *        the entry of a key is found through a hash map
+     *
+     * @author Andrey Valitov
+     *
+     * @version 1.0
+     *
+     * @tparam Key - pointer-like key, for example the node of a list
+     */
+    template<class Key>
+    class PositionalIndex {
+    private:
+
+        static constexpr size_t NIL = std::numeric_limits<size_t>::max();
+
+        struct Entry {
+            Key key;
+            uint64_t priority;
+            size_t left;
+            size_t right;
+            size_t parent;
+            // Number of entries in the subtree, the entry itself included
+            size_t size;
+        };
+
+        std::vector<Entry> entries_;
+
+        // Erased entries of the pool, they are handed out again by the next insertions
+        // Its capacity is kept not less than the size of the pool, so erase() never allocates
+        std::vector<size_t> freeEntries_;
+
+        std::unordered_map<Key, size_t> entryOf_;
+
+        size_t root_ = NIL;
+
+        uint64_t priorityState_ = 0x9E3779B97F4A7C15ull;
+
+        /**
+         * @brief xorshift64* generator of the treap priorities
+         *
+         * @return next pseudo random priority
+         */
+        uint64_t nextPriority() noexcept {
+            priorityState_ ^= priorityState_ >> 12;
+            priorityState_ ^= priorityState_ << 25;
+            priorityState_ ^= priorityState_ >> 27;
+            return priorityState_ * 0x2545F4914F6CDD1Dull;
+        };
+
+        size_t sizeOf(size_t entry) const noexcept {
+            return entry == NIL ? 0 : entries_[entry].size;
+        };
+
+        /**
+         * @brief Recounts the subtree size of the entry and makes it the parent of its children
+         *
+         * @param entry - entry whose children are final
+         */
+        void update(size_t entry) noexcept {
+            Entry &current = entries_[entry];
+            current.size = 1 + sizeOf(current.left) + sizeOf(current.right);
+            if (current.left != NIL) {
+                entries_[current.left].parent = entry;
+            }
+            if (current.right != NIL) {
+                entries_[current.right].parent = entry;
+            }
+        };
+
+        /**
+         * @brief Takes an entry from the pool, the pool grows if there are no erased entries
+         *
+         * @param key - key of the new entry
+         * @return index of the new entry, it is not linked to the tree
+         */
+        size_t createEntry(Key key) {
+            size_t entry;
+            if (freeEntries_.empty()) {
+                entry = entries_.size();
+                if (freeEntries_.capacity() <= entry) {
+                    freeEntries_.reserve(std::max(entry + 1, 2 * freeEntries_.capacity()));
+                }
+                entries_.push_back(Entry{key, nextPriority(), NIL, NIL, NIL, 1});
+            } else {
+                entry = freeEntries_.back();
+                entries_[entry] = Entry{key, nextPriority(), NIL, NIL, NIL, 1};
+                freeEntries_.pop_back();
+            }
+            return entry;
+        };
+
+        /**
+         * @brief Joins two treaps, all entries of left go before the entries of right
+         *
+         * @param left - root of the first treap
+         * @param right - root of the second treap
+         * @return root of the joined treap
+         */
+        size_t merge(size_t left, size_t right) noexcept {
+            if (left == NIL) {
+                return right;
+            }
+            if (right == NIL) {
+                return left;
+            }
+            if (entries_[left].priority > entries_[right].priority) {
+                entries_[left].right = merge(entries_[left].right, right);
+                update(left);
+                return left;
+            }
+            entries_[right].left = merge(left, entries_[right].left);
+            update(right);
+            return right;
+        };
+
+        /**
+         * @brief Splits the treap into the first count entries and the rest
+         *
+         * @param entry - root of the treap
+         * @param count - number of entries which go to left
+         * @param left - root of the first part
+         * @param right - root of the second part
+         */
+        void split(size_t entry, size_t count, size_t &left, size_t &right) noexcept {
+            if (entry == NIL) {
+                left = NIL;
+                right = NIL;
+                return;
+            }
+            size_t leftSize = sizeOf(entries_[entry].left);
+            if (leftSize < count) {
+                size_t rest;
+                split(entries_[entry].right, count - leftSize - 1, entries_[entry].right, rest);
+                update(entry);
+                left = entry;
+                right = rest;
+            } else {
+                size_t first;
+                split(entries_[entry].left, count, first, entries_[entry].left);
+                update(entry);
+                left = first;
+                right = entry;
+            }
+        };
+
+        void setRoot(size_t entry) noexcept {
+            root_ = entry;
+            if (entry != NIL) {
+                entries_[entry].parent = NIL;
+            }
+        };
+
+    public:
+
+        /**
+         * @return number of keys in the index
+         */
+        size_t size() const noexcept {
+            return sizeOf(root_);
+        };
+
+        bool empty() const noexcept {
+            return root_ == NIL;
+        };
+
+        /**
+         * @brief Removes all keys and returns the memory of the pool
+         */
+        void clear() noexcept {
+            entries_.clear();
+            entries_.shrink_to_fit();
+            freeEntries_.clear();
+            freeEntries_.shrink_to_fit();
+            entryOf_.clear();
+            root_ = NIL;
+        };
+
+        /**
+         * @brief Replaces the contents with count keys in O(n)
+         *        The treap is built along its right spine, so no search is done
+         *        On exception the index is left empty
+         *
+         * @param count - number of keys
+         * @param nextKey - function which returns the keys in the sequence order one by one
+         */
+        template<class KeySource>
+        void build(size_t count, KeySource nextKey) {
+            clear();
+            try {
+                entries_.reserve(count);
+                freeEntries_.reserve(count);
+                entryOf_.reserve(count);
+                std::vector<size_t> spine;
+                for (size_t i = 0; i < count; i++) {
+                    Key key = nextKey();
+                    size_t entry = createEntry(key);
+                    entryOf_.emplace(key, entry);
+                    // The popped entries have got all their children and form the left subtree of the new one
+                    size_t last = NIL;
+                    while (!spine.empty() && entries_[spine.back()].priority < entries_[entry].priority) {
+                        last = spine.back();
+                        spine.pop_back();
+                        update(last);
+                    }
+                    entries_[entry].left = last;
+                    if (!spine.empty()) {
+                        entries_[spine.back()].right = entry;
+                    }
+                    spine.push_back(entry);
+                }
+                size_t root = spine.empty() ? NIL : spine.front();
+                while (!spine.empty()) {
+                    update(spine.back());
+                    spine.pop_back();
+                }
+                setRoot(root);
+            } catch (...) {
+                clear();
+                throw;
+            }
+        };
+
+        /**
+         * @brief Inserts the key at position, the keys from position move one place further
+         *
+         * @param position - position of the new key, size() appends it
+         * @param key - key which is not in the index
+         */
+        void insert(size_t position, Key key) {
+            size_t entry = createEntry(key);
+            try {
+                entryOf_.emplace(key, entry);
+            } catch (...) {
+                freeEntries_.push_back(entry);
+                throw;
+            }
+            size_t left;
+            size_t right;
+            split(root_, position, left, right);
+            setRoot(merge(merge(left, entry), right));
+        };
+
+        /**
+         * @brief Removes the key, the keys after it move one place back
+         *        Nothing is allocated, so the treap is never left half-updated
+         *
+         * @param key - key which is in the index
+         */
+        void erase(Key key) {
+            auto found = entryOf_.find(key);
+            size_t entry = found->second;
+            entryOf_.erase(found);
+
+            size_t replacement = merge(entries_[entry].left, entries_[entry].right);
+            size_t parent = entries_[entry].parent;
+            if (parent == NIL) {
+                setRoot(replacement);
+            } else {
+                if (entries_[parent].left == entry) {
+                    entries_[parent].left = replacement;
+                } else {
+                    entries_[parent].right = replacement;
+                }
+                if (replacement != NIL) {
+                    entries_[replacement].parent = parent;
+                }
+                for (size_t current = parent; current != NIL; current = entries_[current].parent) {
+                    --entries_[current].size;
+                }
+            }
+            freeEntries_.push_back(entry);
+        };
+
+        /**
+         * @param key - key which is in the index
+         * @return position of the key in the sequence
+         */
+        size_t index_of(Key key) const {
+            size_t entry = entryOf_.find(key)->second;
+            size_t position = sizeOf(entries_[entry].left);
+            for (size_t parent = entries_[entry].parent; parent != NIL; parent = entries_[entry].parent) {
+                if (entries_[parent].right == entry) {
+                    position += sizeOf(entries_[parent].left) + 1;
+                }
+                entry = parent;
+            }
+            return position;
+        };
+
+        /**
+         * @param position - position less than size()
+         * @return key at the position
+         */
+        Key at(size_t position) const noexcept {
+            size_t entry = root_;
+            while (true) {
+                size_t leftSize = sizeOf(entries_[entry].left);
+                if (position < leftSize) {
+                    entry = entries_[entry].left;
+                } else if (position == leftSize) {
+                    return entries_[entry].key;
+                } else {
+                    position -= leftSize + 1;
+                    entry = entries_[entry].right;
+                }
+            }
+        };
+    };
+
+}
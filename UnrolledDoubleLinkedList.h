@@ -0,0 +1,1002 @@
+#pragma once
+
+#include "LinkedListsException.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace LinkedLists {
+
+    /**
+     * @brief Default number of elements in one chunk of UnrolledDoubleLinkedList
+     *        Chunks of small elements take about four cache lines
+     *
+     * @tparam T
+     * @return number of elements in one chunk
+     */
+    template<class T>
+    constexpr size_t defaultUnrolledChunkCapacity() {
+        return sizeof(T) * 8 >= 256 ? 8 : 256 / sizeof(T);
+    }
+
+    /**
+     * @class UnrolledDoubleLinkedList
+     *
+     * @brief Implements a template unrolled doubly linked list
+     *        Every node (chunk) holds up to ChunkCapacity elements in a small array,
+     *        so scans touch contiguous memory and the links take a fraction of the size
+     *        A full chunk is split in two on insertion, a chunk which became less
+     *        than half full is merged with a neighbour on erasure
+     *
+     *        It keeps the ring view of DoubleLinkedList: the sentinel chunk stored
+     *        inside the list object points to both the first and the last chunk
+     *
+     *        Unlike DoubleLinkedList, insert and erase invalidate the iterators
+     *        to the elements of the chunks they change
+     *
+     * @author Andrey Valitov
+     *
+     * @version 1.0
+     *
+     * @tparam T
+     * @tparam ChunkCapacity - maximum number of elements in one chunk
+     * @tparam Allocator - allocator of T, it is rebound to the chunk type
+     */
+    template<class T, size_t ChunkCapacity = defaultUnrolledChunkCapacity<T>(), class Allocator = std::allocator<T>>
+    class UnrolledDoubleLinkedList {
+    private:
+
+        static_assert(ChunkCapacity >= 2, "A chunk has to hold at least two elements to be split");
+
+        // Links of a chunk, the sentinel consists of them only
+        struct ChunkBase {
+            ChunkBase *prev;
+            ChunkBase *next;
+        };
+
+        struct Chunk : ChunkBase {
+            size_t count;
+            alignas(T) unsigned char storage[sizeof(T) * ChunkCapacity];
+
+            T *elements() {
+                return reinterpret_cast<T *>(storage);
+            };
+
+            const T *elements() const {
+                return reinterpret_cast<const T *>(storage);
+            };
+        };
+
+        using ChunkAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+        using ChunkAllocatorTraits = std::allocator_traits<ChunkAllocator>;
+
+        ChunkBase sentinel_;
+
+        size_t unrolledListSize_;
+
+        ChunkAllocator chunkAllocator_;
+
+        static Chunk *asChunk(ChunkBase *link) {
+            return static_cast<Chunk *>(link);
+        };
+
+        static const Chunk *asChunk(const ChunkBase *link) {
+            return static_cast<const Chunk *>(link);
+        };
+
+        /**
+         * @brief Makes the empty ring of the sentinel
+         */
+        void resetSentinel() noexcept {
+            sentinel_.prev = &sentinel_;
+            sentinel_.next = &sentinel_;
+            unrolledListSize_ = 0;
+        };
+
+        /**
+         * @brief Allocates an empty chunk and links it before the chunk pointed to by before
+         *
+         * @param before - chunk before which the new one is linked
+         * @return the new chunk
+         */
+        Chunk *createChunk(ChunkBase *before) {
+            Chunk *chunk = ChunkAllocatorTraits::allocate(chunkAllocator_, 1);
+            chunk->count = 0;
+            ChunkBase *savePrevBefore = before->prev;
+            savePrevBefore->next = chunk;
+            chunk->prev = savePrevBefore;
+            chunk->next = before;
+            before->prev = chunk;
+            return chunk;
+        };
+
+        /**
+         * @brief Unlinks the chunk and returns it to the allocator, its elements must be already destroyed
+         *
+         * @param chunk - chunk to free
+         */
+        void destroyChunk(Chunk *chunk) {
+            chunk->prev->next = chunk->next;
+            chunk->next->prev = chunk->prev;
+            ChunkAllocatorTraits::deallocate(chunkAllocator_, chunk, 1);
+        };
+
+        /**
+         * @brief Moves the element from one raw slot to another one and destroys the source
+         *
+         * @param to - raw slot to construct in
+         * @param from - element to move from
+         */
+        void relocate(T *to, T *from) {
+            ChunkAllocatorTraits::construct(chunkAllocator_, to, std::move(*from));
+            ChunkAllocatorTraits::destroy(chunkAllocator_, from);
+        };
+
+        /**
+         * @brief Moves the upper half of the full chunk into a new chunk linked after it
+         *
+         * @param chunk - full chunk to split
+         * @return the new chunk
+         */
+        Chunk *splitChunk(Chunk *chunk) {
+            Chunk *newChunk = createChunk(chunk->next);
+            size_t half = chunk->count / 2;
+            for (size_t i = half; i < chunk->count; i++) {
+                relocate(newChunk->elements() + (i - half), chunk->elements() + i);
+            }
+            newChunk->count = chunk->count - half;
+            chunk->count = half;
+            return newChunk;
+        };
+
+        /**
+         * @brief Moves the elements of the next chunk to the end of the chunk, if they fit, and frees the next one
+         *
+         * @param chunk - chunk to merge into
+         */
+        void mergeWithNext(Chunk *chunk) {
+            if (chunk->next == &sentinel_) {
+                return;
+            }
+            Chunk *next = asChunk(chunk->next);
+            if (chunk->count + next->count > ChunkCapacity) {
+                return;
+            }
+            for (size_t i = 0; i < next->count; i++) {
+                relocate(chunk->elements() + chunk->count + i, next->elements() + i);
+            }
+            chunk->count += next->count;
+            destroyChunk(next);
+        };
+
+        /**
+         * @brief Shifts the elements of the chunk from index one place up and constructs
+         *        the new element in the freed slot. If the construction throws, the elements are
+         *        shifted back and the chunk left empty is freed
+         *
+         * @param chunk - chunk which is not full
+         * @param index - position of the new element in the chunk
+         * @param args - arguments forwarded to the constructor of T, they must not refer to the shifted elements
+         */
+        template<class... Args>
+        void constructAt(Chunk *chunk, size_t index, Args &&... args) {
+            T *elements = chunk->elements();
+            for (size_t i = chunk->count; i > index; i--) {
+                relocate(elements + i, elements + i - 1);
+            }
+            try {
+                ChunkAllocatorTraits::construct(chunkAllocator_, elements + index, std::forward<Args>(args)...);
+            } catch (...) {
+                for (size_t i = index; i < chunk->count; i++) {
+                    relocate(elements + i, elements + i + 1);
+                }
+                if (chunk->count == 0) {
+                    destroyChunk(chunk);
+                }
+                throw;
+            }
+            ++chunk->count;
+            ++unrolledListSize_;
+        };
+
+        /**
+         * @brief Copies all elements of other to the end of the current list
+         *        The number of elements is fixed before copying, so other may be the current list
+         *
+         * @param other - list to copy from
+         */
+        void appendCopyOf(const UnrolledDoubleLinkedList &other) {
+            const_iterator current = other.cbegin();
+            for (size_t i = other.size(); i > 0; i--) {
+                push_back(*current);
+                ++current;
+            }
+        };
+
+    public:
+
+        using allocator_type = Allocator;
+
+        /**
+         * @class iterator
+         *
+         * @brief Implements the basic features of the classic non-const iterator from STL
+         *        It points to the chunk and to the element position inside the chunk
+         */
+        class iterator {
+        private:
+
+            friend class UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator>;
+
+            ChunkBase *chunkPointer_;
+
+            size_t index_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            iterator(ChunkBase *chunk, size_t index) : chunkPointer_(chunk), index_(index) {
+            };
+
+            bool operator!=(const iterator &other) const {
+                return chunkPointer_ != other.chunkPointer_ || index_ != other.index_;
+            };
+
+            bool operator==(const iterator &other) const {
+                return !(*this != other);
+            };
+
+            T &operator*() const {
+                return asChunk(chunkPointer_)->elements()[index_];
+            };
+
+            T *operator->() const {
+                return asChunk(chunkPointer_)->elements() + index_;
+            };
+
+            iterator &operator++() {
+                if (++index_ == asChunk(chunkPointer_)->count) {
+                    chunkPointer_ = chunkPointer_->next;
+                    index_ = 0;
+                }
+                return *this;
+            };
+
+            iterator operator++(int) {
+                iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            iterator &operator--() {
+                if (index_ == 0) {
+                    chunkPointer_ = chunkPointer_->prev;
+                    index_ = asChunk(chunkPointer_)->count;
+                }
+                --index_;
+                return *this;
+            };
+
+            iterator operator--(int) {
+                iterator old = *this;
+                --(*this);
+                return old;
+            };
+
+            /**
+             * @brief Moves the iterator forward, whole chunks are skipped by their sizes
+             *
+             * @param shift - number of elements to skip, the iterator must not go past end()
+             */
+            void advance(size_t shift) {
+                while (shift > 0) {
+                    size_t leftInChunk = asChunk(chunkPointer_)->count - index_;
+                    if (shift < leftInChunk) {
+                        index_ += shift;
+                        return;
+                    }
+                    shift -= leftInChunk;
+                    chunkPointer_ = chunkPointer_->next;
+                    index_ = 0;
+                }
+            };
+
+            /**
+             * @brief Moves the iterator backward, whole chunks are skipped by their sizes
+             *
+             * @param shift - number of elements to skip, the iterator must not go before begin()
+             */
+            void retreat(size_t shift) {
+                while (shift > index_) {
+                    // The last element of the previous chunk is index_ + 1 elements back
+                    shift -= index_ + 1;
+                    chunkPointer_ = chunkPointer_->prev;
+                    index_ = asChunk(chunkPointer_)->count - 1;
+                }
+                index_ -= shift;
+            };
+
+            /**
+             * @brief Offset the iterator by an arbitrary integer, backwards for a negative shift
+             *
+             * @param shift - the offset value of the iterator
+             * @param it - iterator to which the offset is applied
+             * @return iterator after applying the offset
+             */
+            friend iterator operator+(const std::ptrdiff_t shift, const iterator &it) {
+                iterator current(it);
+                if (shift > 0) {
+                    current.advance(static_cast<size_t>(shift));
+                } else if (shift < 0) {
+                    current.retreat(static_cast<size_t>(-shift));
+                }
+                return current;
+            }
+
+            friend iterator operator+(const iterator &it, const std::ptrdiff_t shift) {
+                return shift + it;
+            }
+
+            friend iterator operator-(const iterator &it, const std::ptrdiff_t shift) {
+                return -shift + it;
+            }
+        };
+
+        /**
+         * @class const_iterator
+         *
+         * @brief Implements the basic features of the classic const iterator from STL
+         *        Implementation features are described in the class iterator
+         */
+        class const_iterator {
+        private:
+
+            friend class UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator>;
+
+            const ChunkBase *constChunkPointer_;
+
+            size_t index_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            const_iterator(const ChunkBase *chunk, size_t index) : constChunkPointer_(chunk), index_(index) {
+            };
+
+            const_iterator(const iterator &other) : constChunkPointer_(other.chunkPointer_), index_(other.index_) {
+            };
+
+            bool operator!=(const const_iterator &other) const {
+                return constChunkPointer_ != other.constChunkPointer_ || index_ != other.index_;
+            };
+
+            bool operator==(const const_iterator &other) const {
+                return !(*this != other);
+            };
+
+            const T &operator*() const {
+                return asChunk(constChunkPointer_)->elements()[index_];
+            };
+
+            const T *operator->() const {
+                return asChunk(constChunkPointer_)->elements() + index_;
+            };
+
+            const_iterator &operator++() {
+                if (++index_ == asChunk(constChunkPointer_)->count) {
+                    constChunkPointer_ = constChunkPointer_->next;
+                    index_ = 0;
+                }
+                return *this;
+            };
+
+            const_iterator operator++(int) {
+                const_iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            const_iterator &operator--() {
+                if (index_ == 0) {
+                    constChunkPointer_ = constChunkPointer_->prev;
+                    index_ = asChunk(constChunkPointer_)->count;
+                }
+                --index_;
+                return *this;
+            };
+
+            const_iterator operator--(int) {
+                const_iterator old = *this;
+                --(*this);
+                return old;
+            };
+
+            void advance(size_t shift) {
+                while (shift > 0) {
+                    size_t leftInChunk = asChunk(constChunkPointer_)->count - index_;
+                    if (shift < leftInChunk) {
+                        index_ += shift;
+                        return;
+                    }
+                    shift -= leftInChunk;
+                    constChunkPointer_ = constChunkPointer_->next;
+                    index_ = 0;
+                }
+            };
+
+            void retreat(size_t shift) {
+                while (shift > index_) {
+                    shift -= index_ + 1;
+                    constChunkPointer_ = constChunkPointer_->prev;
+                    index_ = asChunk(constChunkPointer_)->count - 1;
+                }
+                index_ -= shift;
+            };
+
+            friend const_iterator operator+(const std::ptrdiff_t shift, const const_iterator &it) {
+                const_iterator current(it);
+                if (shift > 0) {
+                    current.advance(static_cast<size_t>(shift));
+                } else if (shift < 0) {
+                    current.retreat(static_cast<size_t>(-shift));
+                }
+                return current;
+            }
+
+            friend const_iterator operator+(const const_iterator &it, const std::ptrdiff_t shift) {
+                return shift + it;
+            }
+
+            friend const_iterator operator-(const const_iterator &it, const std::ptrdiff_t shift) {
+                return -shift + it;
+            }
+        };
+
+        /**
+         * @brief Constructor - empty list initialization
+         */
+        UnrolledDoubleLinkedList() noexcept(noexcept(Allocator())): UnrolledDoubleLinkedList(Allocator()) {
+        };
+
+        /**
+         * @brief Constructor - empty list initialization with the given allocator
+         *
+         * @param allocator - allocator used for all chunks
+         */
+        explicit UnrolledDoubleLinkedList(const Allocator &allocator) noexcept: chunkAllocator_(allocator) {
+            resetSentinel();
+        };
+
+        /**
+         * @brief Copy constructor
+         *
+         * @param other - copy source
+         */
+        UnrolledDoubleLinkedList(const UnrolledDoubleLinkedList &other)
+                : UnrolledDoubleLinkedList(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                other.get_allocator())) {
+            appendCopyOf(other);
+        };
+
+        /**
+         * @brief Move constructor
+         *        Chunks are relinked to the new sentinel, other stays a valid empty list
+         *
+         * @param other - list, the control on which need to move
+         */
+        UnrolledDoubleLinkedList(UnrolledDoubleLinkedList &&other) noexcept: chunkAllocator_(other.chunkAllocator_) {
+            resetSentinel();
+            swap(other);
+        };
+
+        /**
+         * @brief Destructor
+         */
+        ~UnrolledDoubleLinkedList() {
+            clear();
+        };
+
+        /**
+         * @brief Copy assignment
+         *
+         * @param other - the list to copy from
+         * @return rewritten existing list
+         */
+        UnrolledDoubleLinkedList &operator=(const UnrolledDoubleLinkedList &other) {
+            if (this != &other) {
+                clear();
+                if constexpr (ChunkAllocatorTraits::propagate_on_container_copy_assignment::value) {
+                    chunkAllocator_ = other.chunkAllocator_;
+                }
+                appendCopyOf(other);
+            }
+            return *this;
+        };
+
+        /**
+         * @brief Move assignment
+         *        If the allocators do not propagate and are not equal, the elements are moved one by one
+         *
+         * @param other - the list to move from
+         * @return rewritten existing list
+         */
+        UnrolledDoubleLinkedList &operator=(UnrolledDoubleLinkedList &&other) noexcept(
+                ChunkAllocatorTraits::propagate_on_container_move_assignment::value ||
+                ChunkAllocatorTraits::is_always_equal::value) {
+            if (this != &other) {
+                clear();
+                if constexpr (ChunkAllocatorTraits::propagate_on_container_move_assignment::value) {
+                    chunkAllocator_ = other.chunkAllocator_;
+                } else {
+                    if (chunkAllocator_ != other.chunkAllocator_) {
+                        for (T &value : other) {
+                            push_back(std::move(value));
+                        }
+                        other.clear();
+                        return *this;
+                    }
+                }
+                swap(other);
+            }
+            return *this;
+        };
+
+        /**
+         * @brief Exchanges the contents of two lists without allocations
+         *
+         * @param other - the list to exchange with
+         */
+        void swap(UnrolledDoubleLinkedList &other) noexcept {
+            if (this == &other) {
+                return;
+            }
+            if constexpr (ChunkAllocatorTraits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(chunkAllocator_, other.chunkAllocator_);
+            }
+            ChunkBase *head = empty() ? nullptr : sentinel_.next;
+            ChunkBase *tail = sentinel_.prev;
+            ChunkBase *otherHead = other.empty() ? nullptr : other.sentinel_.next;
+            ChunkBase *otherTail = other.sentinel_.prev;
+            size_t otherSize = other.unrolledListSize_;
+            other.resetSentinel();
+            if (head != nullptr) {
+                other.sentinel_.next = head;
+                other.sentinel_.prev = tail;
+                head->prev = &other.sentinel_;
+                tail->next = &other.sentinel_;
+                other.unrolledListSize_ = unrolledListSize_;
+            }
+            resetSentinel();
+            if (otherHead != nullptr) {
+                sentinel_.next = otherHead;
+                sentinel_.prev = otherTail;
+                otherHead->prev = &sentinel_;
+                otherTail->next = &sentinel_;
+                unrolledListSize_ = otherSize;
+            }
+        };
+
+        /**
+         * @return copy of the allocator used by the list
+         */
+        allocator_type get_allocator() const {
+            return allocator_type(chunkAllocator_);
+        };
+
+        iterator begin() {
+            return iterator(sentinel_.next, 0);
+        };
+
+        const_iterator begin() const {
+            return const_iterator(sentinel_.next, 0);
+        };
+
+        const_iterator cbegin() const {
+            return const_iterator(sentinel_.next, 0);
+        };
+
+        iterator end() {
+            return iterator(&sentinel_, 0);
+        };
+
+        const_iterator end() const {
+            return const_iterator(&sentinel_, 0);
+        };
+
+        const_iterator cend() const {
+            return const_iterator(&sentinel_, 0);
+        };
+
+        /**
+         * @return list size
+         */
+        [[nodiscard]] size_t size() const {
+            return unrolledListSize_;
+        };
+
+        /**
+         * @return true, if the list is empty
+         *         false, if not
+         */
+        [[nodiscard]] bool empty() const {
+            return unrolledListSize_ == 0;
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the first element in the list
+         */
+        T &front() {
+            if (!empty()) {
+                return *begin();
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the first item in the list");
+            }
+        };
+
+        const T &front() const {
+            if (!empty()) {
+                return *begin();
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the first item in the list");
+            }
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the last element in the list
+         */
+        T &back() {
+            if (!empty()) {
+                return *(--end());
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the last item in the list");
+            }
+        };
+
+        const T &back() const {
+            if (!empty()) {
+                return *(--end());
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the last item in the list");
+            }
+        };
+
+        /**
+         * @brief Constructs the new element before the element pointed to by before
+         *        A full chunk is split in two halves first
+         *        Elements are appended in place. Otherwise the split and the shift move elements
+         *        of the list, which args may refer to, so the new value is built before them
+         *
+         * @param before - iterator, before which need to add a new element
+         * @param args - arguments forwarded to the constructor of T
+         * @return iterator that points to the new element in the list
+         */
+        template<class... Args>
+        iterator emplace(iterator before, Args &&... args) {
+            if (before.chunkPointer_ == &sentinel_) {
+                // Append to the last chunk, a new one is started when it is full
+                Chunk *chunk;
+                if (empty() || asChunk(sentinel_.prev)->count == ChunkCapacity) {
+                    chunk = createChunk(&sentinel_);
+                } else {
+                    chunk = asChunk(sentinel_.prev);
+                }
+                size_t index = chunk->count;
+                constructAt(chunk, index, std::forward<Args>(args)...);
+                return iterator(chunk, index);
+            }
+
+            T value(std::forward<Args>(args)...);
+            Chunk *chunk = asChunk(before.chunkPointer_);
+            size_t index = before.index_;
+            if (chunk->count == ChunkCapacity) {
+                Chunk *upperHalf = splitChunk(chunk);
+                if (index > chunk->count) {
+                    index -= chunk->count;
+                    chunk = upperHalf;
+                }
+            }
+            constructAt(chunk, index, std::move(value));
+            return iterator(chunk, index);
+        };
+
+        iterator insert(iterator before, const T &value) {
+            return emplace(before, value);
+        };
+
+        iterator insert(iterator before, T &&value) {
+            return emplace(before, std::move(value));
+        };
+
+        template<class... Args>
+        T &emplace_back(Args &&... args) {
+            return *emplace(end(), std::forward<Args>(args)...);
+        };
+
+        template<class... Args>
+        T &emplace_front(Args &&... args) {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        };
+
+        void push_back(const T &value) {
+            emplace(end(), value);
+        };
+
+        void push_back(T &&value) {
+            emplace(end(), std::move(value));
+        };
+
+        void push_front(const T &value) {
+            emplace(begin(), value);
+        };
+
+        void push_front(T &&value) {
+            emplace(begin(), std::move(value));
+        };
+
+        /**
+         * @brief Deletes the element pointed to by the position iterator
+         *        A chunk which became less than half full is merged with a neighbour, if they fit together
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param position - iterator that points to the element to delete
+         * @return iterator to the next element that fell into place of the deleted one
+         */
+        iterator erase(iterator position) {
+            if (position == end()) {
+                throw LinkedLists::LinkedListsException("Can't erase a nonexistent element in erase method");
+            }
+
+            Chunk *chunk = asChunk(position.chunkPointer_);
+            size_t index = position.index_;
+            T *elements = chunk->elements();
+            ChunkAllocatorTraits::destroy(chunkAllocator_, elements + index);
+            for (size_t i = index + 1; i < chunk->count; i++) {
+                relocate(elements + i - 1, elements + i);
+            }
+            --chunk->count;
+            --unrolledListSize_;
+
+            if (chunk->count == 0) {
+                ChunkBase *next = chunk->next;
+                destroyChunk(chunk);
+                return iterator(next, 0);
+            }
+            if (chunk->count < ChunkCapacity / 2) {
+                if (chunk->prev != &sentinel_ && asChunk(chunk->prev)->count + chunk->count <= ChunkCapacity) {
+                    Chunk *prev = asChunk(chunk->prev);
+                    index += prev->count;
+                    mergeWithNext(prev);
+                    chunk = prev;
+                } else {
+                    mergeWithNext(chunk);
+                }
+            }
+            if (index < chunk->count) {
+                return iterator(chunk, index);
+            }
+            return iterator(chunk->next, 0);
+        };
+
+        /**
+         * @brief Deletes the elements pointed from begin to end (not include) iterators
+         *
+         * @param begin - iterator that points to the element to start delete
+         * @param end - iterator that points to the element to finish delete
+         * @return iterator to the element after the deleted ones
+         */
+        iterator erase(iterator begin, iterator end) {
+            // Erasure moves elements between chunks, so end is turned into the number of elements
+            size_t count = 0;
+            for (iterator current = begin; current != end; ++current) {
+                ++count;
+            }
+            iterator current = begin;
+            for (; count > 0; count--) {
+                current = erase(current);
+            }
+            return current;
+        };
+
+        /**
+         * @brief Delete all list elements which contains data = value
+         *
+         * @param value - the data elements which will be deleted
+         * @return number of deleted elements in the list
+         */
+        size_t remove(const T &value) {
+            size_t counter = 0;
+            iterator current = begin();
+            while (current != end()) {
+                if (*current == value) {
+                    current = erase(current);
+                    ++counter;
+                } else {
+                    ++current;
+                }
+            }
+            return counter;
+        };
+
+        /**
+         * @brief Clear current list, chunk by chunk
+         */
+        void clear() {
+            while (sentinel_.next != &sentinel_) {
+                Chunk *chunk = asChunk(sentinel_.next);
+                if constexpr (!std::is_trivially_destructible_v<T>) {
+                    for (size_t i = 0; i < chunk->count; i++) {
+                        ChunkAllocatorTraits::destroy(chunkAllocator_, chunk->elements() + i);
+                    }
+                }
+                destroyChunk(chunk);
+            }
+            unrolledListSize_ = 0;
+        };
+
+        void pop_back() {
+            erase(--end());
+        };
+
+        void pop_front() {
+            erase(begin());
+        };
+
+        /**
+         * @brief Adds another existing list to the end of the current list
+         *
+         * @param other - the list that will be attached to the end of the current one
+         * @return advanced existing list
+         */
+        UnrolledDoubleLinkedList &operator+=(const UnrolledDoubleLinkedList &other) {
+            appendCopyOf(other);
+            return *this;
+        };
+
+        /**
+         * @return number of chunks in the list
+         */
+        [[nodiscard]] size_t chunks_count() const {
+            size_t counter = 0;
+            for (const ChunkBase *chunk = sentinel_.next; chunk != &sentinel_; chunk = chunk->next) {
+                ++counter;
+            }
+            return counter;
+        };
+
+        /**
+         * @brief Compares two lists element by element, the elements inside chunks are compared as arrays
+         *
+         * @param other - list to compare with
+         * @return true, if the lists are equal
+         *         false, if not
+         */
+        [[nodiscard]] bool equals(const UnrolledDoubleLinkedList &other) const {
+            if (this == &other) {
+                return true;
+            }
+            if (size() != other.size()) {
+                return false;
+            }
+
+            const ChunkBase *leftChunk = sentinel_.next;
+            const ChunkBase *rightChunk = other.sentinel_.next;
+            size_t leftIndex = 0;
+            size_t rightIndex = 0;
+            while (leftChunk != &sentinel_) {
+                const T *left = asChunk(leftChunk)->elements();
+                const T *right = asChunk(rightChunk)->elements();
+                size_t leftCount = asChunk(leftChunk)->count;
+                size_t rightCount = asChunk(rightChunk)->count;
+                size_t step = std::min(leftCount - leftIndex, rightCount - rightIndex);
+                for (size_t i = 0; i < step; i++) {
+                    if (left[leftIndex + i] != right[rightIndex + i]) {
+                        return false;
+                    }
+                }
+                leftIndex += step;
+                rightIndex += step;
+                if (leftIndex == leftCount) {
+                    leftChunk = leftChunk->next;
+                    leftIndex = 0;
+                }
+                if (rightIndex == rightCount) {
+                    rightChunk = rightChunk->next;
+                    rightIndex = 0;
+                }
+            }
+            return true;
+        };
+    };
+
+    template<class T, size_t ChunkCapacity, class Allocator>
+    void swap(UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &left,
+              UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &right) noexcept {
+        left.swap(right);
+    }
+
+    /**
+     * @brief Compares two lists element by element for the equality
+     *
+     * @param left - first list to compare
+     * @param right - second list to compare
+     * @return true, if the lists are equal
+     *         false, if not
+     */
+    template<class T, size_t ChunkCapacity, class Allocator>
+    bool operator==(const UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &left,
+                    const UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &right) {
+        return left.equals(right);
+    }
+
+    /**
+     * @brief Compares two lists element by element for the inequality
+     *
+     * @param left - first list to compare
+     * @param right - second list to compare
+     * @return true, if the lists are not equal
+     *         false, if equal
+     */
+    template<class T, size_t ChunkCapacity, class Allocator>
+    bool operator!=(const UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &left,
+                    const UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &right) {
+        return !left.equals(right);
+    }
+
+    /**
+     * @brief Outputs the entire list to out using the following template:
+     *        [el_1 <---> el_2 <---> ... <---> el_n]
+     *
+     * @param out - output stream
+     * @param unrolledList - the list for print to the out stream
+     * @return output stream after using
+     */
+    template<class T, size_t ChunkCapacity, class Allocator>
+    std::ostream &operator<<(std::ostream &out, const UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &unrolledList) {
+        out << "[";
+        size_t printed = 0;
+        for (auto current = unrolledList.cbegin(); current != unrolledList.cend(); ++current) {
+            out << *current;
+            if (++printed != unrolledList.size()) {
+                out << " <---> ";
+            }
+        }
+        out << "]" << std::endl;
+        return out;
+    }
+
+    /**
+     * @brief Merges two lists into one
+     *
+     * @param left - first list to join
+     * @param right - second list to join
+     * @return merged list
+     */
+    template<class T, size_t ChunkCapacity, class Allocator>
+    UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> operator+(
+            const UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &left,
+            const UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> &right) {
+        UnrolledDoubleLinkedList<T, ChunkCapacity, Allocator> list(left);
+        list += right;
+        return list;
+    }
+
+}
@@ -0,0 +1,184 @@
+#include "UnrolledDoubleLinkedList.h"
+#include "ListTestHarness.h"
+#include "gtest/gtest.h"
+
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace googleTests {
+
+    const static size_t UNROLLED_CHUNK_CAPACITY = 4;
+
+    using UnrolledListOfInt = LinkedLists::UnrolledDoubleLinkedList<int, UNROLLED_CHUNK_CAPACITY>;
+
+    INSTANTIATE_TYPED_TEST_SUITE_P(Unrolled, ListReferenceFixtureClassTest, ::testing::Types<UnrolledListOfInt>);
+
+    class UnrolledDoubleLinkedListFixtureClassTest : public ::testing::Test {
+    protected:
+
+        using UnrolledList = UnrolledListOfInt;
+
+        void SetUp() override {
+            for (int i = 0; i < 10; i++) {
+                nonEmptyList.push_back(i);
+            }
+        }
+
+        UnrolledList emptyList;
+        UnrolledList nonEmptyList;
+    };
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, PushBackFillsChunks) {
+        EXPECT_EQ(0, emptyList.chunks_count());
+        EXPECT_EQ(10, nonEmptyList.size());
+        EXPECT_EQ(3, nonEmptyList.chunks_count());
+        EXPECT_EQ(0, nonEmptyList.front());
+        EXPECT_EQ(9, nonEmptyList.back());
+        EXPECT_EQ(5, *(nonEmptyList.begin() + 5));
+        EXPECT_EQ(9, *(--nonEmptyList.end()));
+    }
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, SignedShiftsCrossChunks) {
+        // Chunks of 4, 4 and 2 elements
+        for (std::ptrdiff_t shift = 1; shift <= 10; shift++) {
+            EXPECT_EQ(10 - shift, *(nonEmptyList.end() + (-shift)));
+            EXPECT_EQ(10 - shift, *(nonEmptyList.cend() - shift));
+        }
+        auto sixth = nonEmptyList.begin() + 6;
+        EXPECT_EQ(1, *(sixth - 5));
+        EXPECT_EQ(true, sixth - 6 == nonEmptyList.begin());
+        EXPECT_EQ(true, sixth + 4 == nonEmptyList.end());
+        EXPECT_EQ(true, (sixth - 2) + 2 == sixth);
+    }
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, InsertSplitsAndEraseMergesChunks) {
+        std::list<int> reference(nonEmptyList.begin(), nonEmptyList.end());
+        auto inserted = nonEmptyList.insert(nonEmptyList.begin() + 1, 100);
+        reference.insert(std::next(reference.begin()), 100);
+        EXPECT_EQ(100, *inserted);
+        EXPECT_EQ(4, nonEmptyList.chunks_count());
+        EXPECT_EQ(true, isEqualToReference(nonEmptyList, reference));
+
+        while (nonEmptyList.size() > 2) {
+            nonEmptyList.erase(nonEmptyList.begin() + 1);
+            reference.erase(std::next(reference.begin()));
+            EXPECT_EQ(true, isEqualToReference(nonEmptyList, reference));
+        }
+        EXPECT_EQ(1, nonEmptyList.chunks_count());
+    }
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, InsertElementOfSameList) {
+        // Long strings live on the heap, so a moved-from or destroyed source is visible
+        LinkedLists::UnrolledDoubleLinkedList<std::string, UNROLLED_CHUNK_CAPACITY> list;
+        for (int i = 0; i < 4; i++) {
+            list.push_back(std::string(32, static_cast<char>('a' + i)));
+        }
+        // The chunk is full: the front is moved by the split and by the shift
+        list.push_front(list.front());
+        EXPECT_EQ(5, list.size());
+        EXPECT_EQ(std::string(32, 'a'), *list.begin());
+        EXPECT_EQ(std::string(32, 'a'), *(list.begin() + 1));
+
+        // Inside one chunk which is not full: the slot of the argument is taken by its left neighbour
+        list.erase(list.begin());
+        list.erase(--list.end());
+        list.insert(list.begin() + 1, list.back());
+        EXPECT_EQ(std::string(32, 'a'), *list.begin());
+        EXPECT_EQ(std::string(32, 'c'), *(list.begin() + 1));
+        EXPECT_EQ(std::string(32, 'b'), *(list.begin() + 2));
+        EXPECT_EQ(std::string(32, 'c'), list.back());
+        list.push_back(list.front());
+        EXPECT_EQ(std::string(32, 'a'), list.back());
+    }
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, InsertAtEveryPositionOfFullChunks) {
+        for (int position = 0; position <= 8; position++) {
+            // Two full chunks: 0 1 2 3 | 4 5 6 7
+            UnrolledList list;
+            for (int i = 0; i < 8; i++) {
+                list.push_back(i);
+            }
+            std::list<int> reference(list.begin(), list.end());
+
+            // Every position, the chunk boundary and the end included, splits one chunk or starts a new one
+            auto inserted = list.insert(list.begin() + position, 100);
+            reference.insert(std::next(reference.begin(), position), 100);
+            EXPECT_EQ(3, list.chunks_count());
+            EXPECT_EQ(true, isEqualToReference(list, reference));
+            EXPECT_EQ(100, *inserted);
+            if (position > 0) {
+                EXPECT_EQ(position - 1, *(inserted - 1));
+            }
+            EXPECT_EQ(true, inserted + (9 - position) == list.end());
+            EXPECT_EQ(true, inserted - position == list.begin());
+        }
+    }
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, EraseMergesWithNeighbour) {
+        // 0 1 100 | 2 3 | 4 5 6 7
+        UnrolledList list;
+        for (int i = 0; i < 8; i++) {
+            list.push_back(i);
+        }
+        auto inserted = list.insert(list.begin() + 2, 100);
+        EXPECT_EQ(3, list.chunks_count());
+
+        // Half full chunks are kept
+        auto next = list.erase(inserted);
+        EXPECT_EQ(2, *next);
+        EXPECT_EQ(3, list.chunks_count());
+
+        // The first chunk has no previous one, the next one is moved into it: 1 2 3 | 4 5 6 7
+        next = list.erase(list.begin());
+        EXPECT_EQ(1, *next);
+        EXPECT_EQ(2, list.chunks_count());
+        EXPECT_EQ(true, isEqualToReference(list, {1, 2, 3, 4, 5, 6, 7}));
+
+        // The chunks do not fit together: 1 | 4 5 6 7
+        list.erase(list.begin() + 1, list.begin() + 3);
+        EXPECT_EQ(2, list.chunks_count());
+        list.pop_back();
+        list.pop_back();
+        EXPECT_EQ(2, list.chunks_count());
+        // The last chunk is merged into the previous one: 1 4
+        next = list.erase(--list.end());
+        EXPECT_EQ(true, next == list.end());
+        EXPECT_EQ(1, list.chunks_count());
+        EXPECT_EQ(true, isEqualToReference(list, {1, 4}));
+    }
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, InsertElementMovedBySplit) {
+        LinkedLists::UnrolledDoubleLinkedList<std::string, UNROLLED_CHUNK_CAPACITY> list;
+        for (int i = 0; i < 4; i++) {
+            list.push_back(std::string(32, static_cast<char>('a' + i)));
+        }
+        // The argument is in the upper half, which the split moves into the new chunk
+        auto inserted = list.insert(list.begin() + 1, *(list.begin() + 3));
+        EXPECT_EQ(std::string(32, 'd'), *inserted);
+        EXPECT_EQ(std::string(32, 'd'), list.back());
+        EXPECT_EQ(std::string(32, 'b'), *(inserted + 1));
+        EXPECT_EQ(2, list.chunks_count());
+
+        // The argument is in the chunk which is split, in front of the position
+        list.emplace(list.begin() + 3, list.front());
+        EXPECT_EQ(std::string(32, 'a'), *(list.begin() + 3));
+        EXPECT_EQ(std::string(32, 'a'), list.front());
+        EXPECT_EQ(6, list.size());
+    }
+
+    TEST_F(UnrolledDoubleLinkedListFixtureClassTest, MoveOnlyElements) {
+        LinkedLists::UnrolledDoubleLinkedList<std::unique_ptr<std::string>, UNROLLED_CHUNK_CAPACITY> list;
+        for (int i = 0; i < 10; i++) {
+            list.emplace_front(new std::string(std::to_string(i)));
+        }
+        list.erase(list.begin() + 3, list.begin() + 8);
+        EXPECT_EQ(5, list.size());
+        EXPECT_EQ("9", *list.front());
+        EXPECT_EQ("0", *list.back());
+        list.clear();
+        EXPECT_EQ(0, list.chunks_count());
+    }
+
+}
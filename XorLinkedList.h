@@ -0,0 +1,749 @@
+#pragma once
+
+#include "LinkedListsException.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace LinkedLists {
+
+    /**
+     * @class XorLinkedList
+     *
+     * @brief Implements a template doubly linked list which keeps one word of links per node:
+     *        the address of the previous node XORed with the address of the next one
+     *        It saves 8 bytes per node on 64-bit builds at the cost of an extra XOR per step
+     *        and of iterators which carry two pointers
+     *
+     *        It keeps the ring view of DoubleLinkedList: the sentinel stored inside the list
+     *        object sits between the last and the first nodes. The list remembers the first
+     *        node, the last one is decoded from the link of the sentinel
+     *
+     *        An iterator depends on its predecessor, so insert and erase invalidate
+     *        the iterators to the element after the changed position
+     *
+     * @author Andrey Valitov
+     *
+     * @version 1.0
+     *
+     * @tparam T
+     * @tparam Allocator - allocator of T, it is rebound to the node type
+     */
+    template<class T, class Allocator = std::allocator<T>>
+    class XorLinkedList {
+    private:
+
+        // The link of a node, the sentinel consists of it only
+        struct NodeBase {
+            std::uintptr_t link;
+        };
+
+        struct Node : NodeBase {
+            T data;
+        };
+
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+        NodeBase sentinel_;
+
+        NodeBase *head_;
+
+        size_t xorLinkedListSize_;
+
+        NodeAllocator nodeAllocator_;
+
+        static std::uintptr_t address(const NodeBase *node) {
+            return reinterpret_cast<std::uintptr_t>(node);
+        };
+
+        /**
+         * @brief Decodes the neighbour of the node on the other side from the known one
+         *
+         * @param node - node whose link is decoded
+         * @param neighbour - one of the neighbours of the node
+         * @return the other neighbour of the node
+         */
+        static NodeBase *otherNeighbour(const NodeBase *node, const NodeBase *neighbour) {
+            return reinterpret_cast<NodeBase *>(node->link ^ address(neighbour));
+        };
+
+        static Node *asNode(NodeBase *link) {
+            return static_cast<Node *>(link);
+        };
+
+        static const Node *asNode(const NodeBase *link) {
+            return static_cast<const Node *>(link);
+        };
+
+        /**
+         * @brief Makes the empty ring of the sentinel, the sentinel is its own neighbour from both sides
+         */
+        void resetSentinel() noexcept {
+            sentinel_.link = 0;
+            head_ = &sentinel_;
+            xorLinkedListSize_ = 0;
+        };
+
+        /**
+         * @return the last node of the list or the sentinel, if the list is empty
+         */
+        NodeBase *tail() const {
+            return otherNeighbour(&sentinel_, head_);
+        };
+
+        /**
+         * @brief Links the node between two adjacent ones
+         *
+         * @param prev - node before the position
+         * @param next - node after the position
+         * @param node - node to link
+         */
+        void linkBetween(NodeBase *prev, NodeBase *next, NodeBase *node) noexcept {
+            node->link = address(prev) ^ address(next);
+            // For the empty list prev and next are both the sentinel, the two updates cancel each other
+            prev->link ^= address(next) ^ address(node);
+            next->link ^= address(prev) ^ address(node);
+            if (prev == &sentinel_) {
+                head_ = node;
+            }
+            ++xorLinkedListSize_;
+        };
+
+        /**
+         * @brief Excludes the node from the list, its neighbours become adjacent
+         *
+         * @param prev - node before the excluded one
+         * @param node - node to exclude
+         * @return node which was after the excluded one
+         */
+        NodeBase *unlink(NodeBase *prev, NodeBase *node) noexcept {
+            NodeBase *next = otherNeighbour(node, prev);
+            prev->link ^= address(node) ^ address(next);
+            next->link ^= address(node) ^ address(prev);
+            if (node == head_) {
+                head_ = next;
+            }
+            --xorLinkedListSize_;
+            return next;
+        };
+
+        template<class... Args>
+        Node *createNode(Args &&... args) {
+            Node *node = NodeAllocatorTraits::allocate(nodeAllocator_, 1);
+            try {
+                NodeAllocatorTraits::construct(nodeAllocator_, std::addressof(node->data), std::forward<Args>(args)...);
+            } catch (...) {
+                NodeAllocatorTraits::deallocate(nodeAllocator_, node, 1);
+                throw;
+            }
+            return node;
+        };
+
+        void destroyNode(NodeBase *link) noexcept {
+            Node *node = asNode(link);
+            NodeAllocatorTraits::destroy(nodeAllocator_, std::addressof(node->data));
+            NodeAllocatorTraits::deallocate(nodeAllocator_, node, 1);
+        };
+
+        /**
+         * @brief Copies all elements of other to the end of the current list
+         *        The number of elements is fixed before copying, so other may be the current list
+         *
+         * @param other - list to copy from
+         */
+        void appendCopyOf(const XorLinkedList &other) {
+            const_iterator current = other.cbegin();
+            for (size_t i = other.size(); i > 0; i--) {
+                push_back(*current);
+                ++current;
+            }
+        };
+
+    public:
+
+        using allocator_type = Allocator;
+
+        /**
+         * @class iterator
+         *
+         * @brief Implements the basic features of the classic non-const iterator from STL
+         *        It points to the node and to its predecessor, which is needed to decode the links
+         */
+        class iterator {
+        private:
+
+            friend class XorLinkedList<T, Allocator>;
+
+            NodeBase *prev_;
+
+            NodeBase *current_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            iterator(NodeBase *prev, NodeBase *current) : prev_(prev), current_(current) {
+            };
+
+            bool operator!=(const iterator &other) const {
+                return current_ != other.current_;
+            };
+
+            bool operator==(const iterator &other) const {
+                return current_ == other.current_;
+            };
+
+            T &operator*() const {
+                return asNode(current_)->data;
+            };
+
+            T *operator->() const {
+                return std::addressof(asNode(current_)->data);
+            };
+
+            iterator &operator++() {
+                NodeBase *next = otherNeighbour(current_, prev_);
+                prev_ = current_;
+                current_ = next;
+                return *this;
+            };
+
+            iterator operator++(int) {
+                iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            iterator &operator--() {
+                NodeBase *prevPrev = otherNeighbour(prev_, current_);
+                current_ = prev_;
+                prev_ = prevPrev;
+                return *this;
+            };
+
+            iterator operator--(int) {
+                iterator old = *this;
+                --(*this);
+                return old;
+            };
+
+            /**
+             * @brief Offset the iterator by an arbitrary integer, backwards for a negative shift
+             *
+             * @param shift - the offset value of the iterator
+             * @param it - iterator to which the offset is applied
+             * @return iterator after applying the offset
+             */
+            friend iterator operator+(const std::ptrdiff_t shift, const iterator &it) {
+                iterator current(it);
+                for (std::ptrdiff_t i = 0; i < shift; i++) {
+                    ++current;
+                }
+                for (std::ptrdiff_t i = 0; i > shift; i--) {
+                    --current;
+                }
+                return current;
+            }
+
+            friend iterator operator+(const iterator &it, const std::ptrdiff_t shift) {
+                return shift + it;
+            }
+
+            friend iterator operator-(const iterator &it, const std::ptrdiff_t shift) {
+                return -shift + it;
+            }
+        };
+
+        /**
+         * @class const_iterator
+         *
+         * @brief Implements the basic features of the classic const iterator from STL
+         *        Implementation features are described in the class iterator
+         */
+        class const_iterator {
+        private:
+
+            friend class XorLinkedList<T, Allocator>;
+
+            const NodeBase *constPrev_;
+
+            const NodeBase *constCurrent_;
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            const_iterator(const NodeBase *prev, const NodeBase *current) : constPrev_(prev), constCurrent_(current) {
+            };
+
+            const_iterator(const iterator &other) : constPrev_(other.prev_), constCurrent_(other.current_) {
+            };
+
+            bool operator!=(const const_iterator &other) const {
+                return constCurrent_ != other.constCurrent_;
+            };
+
+            bool operator==(const const_iterator &other) const {
+                return constCurrent_ == other.constCurrent_;
+            };
+
+            const T &operator*() const {
+                return asNode(constCurrent_)->data;
+            };
+
+            const T *operator->() const {
+                return std::addressof(asNode(constCurrent_)->data);
+            };
+
+            const_iterator &operator++() {
+                const NodeBase *next = otherNeighbour(constCurrent_, constPrev_);
+                constPrev_ = constCurrent_;
+                constCurrent_ = next;
+                return *this;
+            };
+
+            const_iterator operator++(int) {
+                const_iterator old = *this;
+                ++(*this);
+                return old;
+            };
+
+            const_iterator &operator--() {
+                const NodeBase *prevPrev = otherNeighbour(constPrev_, constCurrent_);
+                constCurrent_ = constPrev_;
+                constPrev_ = prevPrev;
+                return *this;
+            };
+
+            const_iterator operator--(int) {
+                const_iterator old = *this;
+                --(*this);
+                return old;
+            };
+
+            friend const_iterator operator+(const std::ptrdiff_t shift, const const_iterator &it) {
+                const_iterator current(it);
+                for (std::ptrdiff_t i = 0; i < shift; i++) {
+                    ++current;
+                }
+                for (std::ptrdiff_t i = 0; i > shift; i--) {
+                    --current;
+                }
+                return current;
+            }
+
+            friend const_iterator operator+(const const_iterator &it, const std::ptrdiff_t shift) {
+                return shift + it;
+            }
+
+            friend const_iterator operator-(const const_iterator &it, const std::ptrdiff_t shift) {
+                return -shift + it;
+            }
+        };
+
+        /**
+         * @brief Constructor - empty list initialization
+         */
+        XorLinkedList() noexcept(noexcept(Allocator())): XorLinkedList(Allocator()) {
+        };
+
+        /**
+         * @brief Constructor - empty list initialization with the given allocator
+         *
+         * @param allocator - allocator used for all nodes
+         */
+        explicit XorLinkedList(const Allocator &allocator) noexcept: nodeAllocator_(allocator) {
+            resetSentinel();
+        };
+
+        /**
+         * @brief Copy constructor
+         *
+         * @param other - copy source
+         */
+        XorLinkedList(const XorLinkedList &other)
+                : XorLinkedList(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                other.get_allocator())) {
+            appendCopyOf(other);
+        };
+
+        /**
+         * @brief Move constructor
+         *        Nodes are relinked to the new sentinel, other stays a valid empty list
+         *
+         * @param other - list, the control on which need to move
+         */
+        XorLinkedList(XorLinkedList &&other) noexcept: nodeAllocator_(other.nodeAllocator_) {
+            resetSentinel();
+            swap(other);
+        };
+
+        /**
+         * @brief Destructor
+         */
+        ~XorLinkedList() {
+            clear();
+        };
+
+        /**
+         * @brief Copy assignment
+         *
+         * @param other - the list to copy from
+         * @return rewritten existing list
+         */
+        XorLinkedList &operator=(const XorLinkedList &other) {
+            if (this != &other) {
+                clear();
+                if constexpr (NodeAllocatorTraits::propagate_on_container_copy_assignment::value) {
+                    nodeAllocator_ = other.nodeAllocator_;
+                }
+                appendCopyOf(other);
+            }
+            return *this;
+        };
+
+        /**
+         * @brief Move assignment
+         *        If the allocators do not propagate and are not equal, the elements are moved one by one
+         *
+         * @param other - the list to move from
+         * @return rewritten existing list
+         */
+        XorLinkedList &operator=(XorLinkedList &&other) noexcept(
+                NodeAllocatorTraits::propagate_on_container_move_assignment::value ||
+                NodeAllocatorTraits::is_always_equal::value) {
+            if (this != &other) {
+                clear();
+                if constexpr (NodeAllocatorTraits::propagate_on_container_move_assignment::value) {
+                    nodeAllocator_ = other.nodeAllocator_;
+                } else {
+                    if (nodeAllocator_ != other.nodeAllocator_) {
+                        for (T &value : other) {
+                            push_back(std::move(value));
+                        }
+                        other.clear();
+                        return *this;
+                    }
+                }
+                swap(other);
+            }
+            return *this;
+        };
+
+        /**
+         * @brief Exchanges the contents of two lists without allocations
+         *        Only the links of the first and the last nodes are patched with the new sentinel address
+         *
+         * @param other - the list to exchange with
+         */
+        void swap(XorLinkedList &other) noexcept {
+            if (this == &other) {
+                return;
+            }
+            if constexpr (NodeAllocatorTraits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(nodeAllocator_, other.nodeAllocator_);
+            }
+
+            std::uintptr_t patch = address(&sentinel_) ^ address(&other.sentinel_);
+            // For a single node the head and the tail coincide and its link stays zero
+            if (!empty()) {
+                head_->link ^= patch;
+                tail()->link ^= patch;
+            }
+            if (!other.empty()) {
+                other.head_->link ^= patch;
+                other.tail()->link ^= patch;
+            }
+
+            std::swap(sentinel_.link, other.sentinel_.link);
+            std::swap(xorLinkedListSize_, other.xorLinkedListSize_);
+            NodeBase *head = empty() ? &sentinel_ : other.head_;
+            other.head_ = other.empty() ? &other.sentinel_ : head_;
+            head_ = head;
+        };
+
+        /**
+         * @return copy of the allocator used by the list
+         */
+        allocator_type get_allocator() const {
+            return allocator_type(nodeAllocator_);
+        };
+
+        iterator begin() {
+            return iterator(&sentinel_, head_);
+        };
+
+        const_iterator begin() const {
+            return const_iterator(&sentinel_, head_);
+        };
+
+        const_iterator cbegin() const {
+            return const_iterator(&sentinel_, head_);
+        };
+
+        iterator end() {
+            return iterator(tail(), &sentinel_);
+        };
+
+        const_iterator end() const {
+            return const_iterator(tail(), &sentinel_);
+        };
+
+        const_iterator cend() const {
+            return const_iterator(tail(), &sentinel_);
+        };
+
+        /**
+         * @return list size
+         */
+        [[nodiscard]] size_t size() const {
+            return xorLinkedListSize_;
+        };
+
+        /**
+         * @return true, if the list is empty
+         *         false, if not
+         */
+        [[nodiscard]] bool empty() const {
+            return xorLinkedListSize_ == 0;
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the first element in the list
+         */
+        T &front() {
+            if (!empty()) {
+                return asNode(head_)->data;
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the first item in the list");
+            }
+        };
+
+        const T &front() const {
+            if (!empty()) {
+                return asNode(head_)->data;
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the first item in the list");
+            }
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @return the non-const reference to the last element in the list
+         */
+        T &back() {
+            if (!empty()) {
+                return asNode(tail())->data;
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a reference to the last item in the list");
+            }
+        };
+
+        const T &back() const {
+            if (!empty()) {
+                return asNode(tail())->data;
+            } else {
+                throw LinkedLists::LinkedListsException("Can't return a const reference to the last item in the list");
+            }
+        };
+
+        /**
+         * @brief Constructs the new element before the element pointed to by before
+         *        The iterators to the element pointed to by before are invalidated
+         *
+         * @param before - iterator, before which need to add a new element
+         * @param args - arguments forwarded to the constructor of T
+         * @return iterator that points to the new element in the list
+         */
+        template<class... Args>
+        iterator emplace(iterator before, Args &&... args) {
+            Node *node = createNode(std::forward<Args>(args)...);
+            linkBetween(before.prev_, before.current_, node);
+            return iterator(before.prev_, node);
+        };
+
+        iterator insert(iterator before, const T &value) {
+            return emplace(before, value);
+        };
+
+        iterator insert(iterator before, T &&value) {
+            return emplace(before, std::move(value));
+        };
+
+        template<class... Args>
+        T &emplace_back(Args &&... args) {
+            Node *node = createNode(std::forward<Args>(args)...);
+            linkBetween(tail(), &sentinel_, node);
+            return node->data;
+        };
+
+        template<class... Args>
+        T &emplace_front(Args &&... args) {
+            Node *node = createNode(std::forward<Args>(args)...);
+            linkBetween(&sentinel_, head_, node);
+            return node->data;
+        };
+
+        void push_back(const T &value) {
+            emplace_back(value);
+        };
+
+        void push_back(T &&value) {
+            emplace_back(std::move(value));
+        };
+
+        void push_front(const T &value) {
+            emplace_front(value);
+        };
+
+        void push_front(T &&value) {
+            emplace_front(std::move(value));
+        };
+
+        /**
+         * @brief Deletes the element pointed to by the position iterator
+         *        The iterators to the next element are invalidated, the returned one replaces them
+         *
+         * @throw LinkedLists::LinkedListsException
+         *
+         * @param position - iterator that points to the element to delete
+         * @return iterator to the next element that fell into place of the deleted one
+         */
+        iterator erase(iterator position) {
+            if (position.current_ == &sentinel_) {
+                throw LinkedLists::LinkedListsException("Can't erase a nonexistent element in erase method");
+            }
+
+            NodeBase *next = unlink(position.prev_, position.current_);
+            destroyNode(position.current_);
+            return iterator(position.prev_, next);
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         */
+        void pop_back() {
+            if (empty()) {
+                throw LinkedLists::LinkedListsException("Can't pop the last element of the empty list");
+            }
+            NodeBase *node = tail();
+            unlink(otherNeighbour(node, &sentinel_), node);
+            destroyNode(node);
+        };
+
+        /**
+         * @throw LinkedLists::LinkedListsException
+         */
+        void pop_front() {
+            if (empty()) {
+                throw LinkedLists::LinkedListsException("Can't pop the first element of the empty list");
+            }
+            NodeBase *node = head_;
+            unlink(&sentinel_, node);
+            destroyNode(node);
+        };
+
+        /**
+         * @brief Clear current list
+         */
+        void clear() {
+            NodeBase *prev = &sentinel_;
+            NodeBase *current = head_;
+            while (current != &sentinel_) {
+                NodeBase *next = otherNeighbour(current, prev);
+                prev = current;
+                destroyNode(current);
+                current = next;
+            }
+            resetSentinel();
+        };
+
+        /**
+         * @brief Reverses the order of the elements in O(1)
+         *        A link does not tell the previous neighbour from the next one, so only the last node
+         *        becomes the first. All iterators are invalidated, the elements stay in place
+         */
+        void reverse() noexcept {
+            head_ = tail();
+        };
+    };
+
+    template<class T, class Allocator>
+    void swap(XorLinkedList<T, Allocator> &left, XorLinkedList<T, Allocator> &right) noexcept {
+        left.swap(right);
+    }
+
+    /**
+     * @brief Compares two lists element by element for the equality
+     *
+     * @param left - first list to compare
+     * @param right - second list to compare
+     * @return true, if the lists are equal
+     *         false, if not
+     */
+    template<class T, class Allocator>
+    bool operator==(const XorLinkedList<T, Allocator> &left, const XorLinkedList<T, Allocator> &right) {
+        if (left.size() != right.size()) {
+            return false;
+        }
+        auto rightIterator = right.cbegin();
+        for (auto leftIterator = left.cbegin(); leftIterator != left.cend(); ++leftIterator, ++rightIterator) {
+            if (*leftIterator != *rightIterator) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compares two lists element by element for the inequality
+     *
+     * @param left - first list to compare
+     * @param right - second list to compare
+     * @return true, if the lists are not equal
+     *         false, if equal
+     */
+    template<class T, class Allocator>
+    bool operator!=(const XorLinkedList<T, Allocator> &left, const XorLinkedList<T, Allocator> &right) {
+        return !(left == right);
+    }
+
+    /**
+     * @brief Outputs the entire list to out using the following template:
+     *        [el_1 <---> el_2 <---> ... <---> el_n]
+     *
+     * @param out - output stream
+     * @param xorLinkedList - the list for print to the out stream
+     * @return output stream after using
+     */
+    template<class T, class Allocator>
+    std::ostream &operator<<(std::ostream &out, const XorLinkedList<T, Allocator> &xorLinkedList) {
+        out << "[";
+        size_t printed = 0;
+        for (auto current = xorLinkedList.cbegin(); current != xorLinkedList.cend(); ++current) {
+            out << *current;
+            if (++printed != xorLinkedList.size()) {
+                out << " <---> ";
+            }
+        }
+        out << "]" << std::endl;
+        return out;
+    }
+
+}
@@ -0,0 +1,157 @@
+#include "XorLinkedList.h"
+#include "DoubleLinkedList.h"
+#include "ListTestHarness.h"
+#include "gtest/gtest.h"
+
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace googleTests {
+
+    INSTANTIATE_TYPED_TEST_SUITE_P(Xor, ListReferenceFixtureClassTest, ::testing::Types<LinkedLists::XorLinkedList<int>>);
+
+    /**
+     * @brief Allocator which remembers the size of the last requested block
+     */
+    template<class T>
+    class SizeRecordingAllocator {
+    public:
+        using value_type = T;
+
+        size_t *lastAllocationBytes;
+
+        explicit SizeRecordingAllocator(size_t *bytes) : lastAllocationBytes(bytes) {
+        }
+
+        template<class U>
+        SizeRecordingAllocator(const SizeRecordingAllocator<U> &other) : lastAllocationBytes(other.lastAllocationBytes) {
+        }
+
+        T *allocate(size_t n) {
+            *lastAllocationBytes = n * sizeof(T);
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T *pointer, size_t n) {
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        template<class U>
+        bool operator==(const SizeRecordingAllocator<U> &other) const {
+            return lastAllocationBytes == other.lastAllocationBytes;
+        }
+
+        template<class U>
+        bool operator!=(const SizeRecordingAllocator<U> &other) const {
+            return lastAllocationBytes != other.lastAllocationBytes;
+        }
+    };
+
+    class XorLinkedListFixtureClassTest : public ::testing::Test {
+    protected:
+
+        using XorList = LinkedLists::XorLinkedList<int>;
+
+        void SetUp() override {
+            for (int i = 0; i < 10; i++) {
+                nonEmptyList.push_back(i);
+            }
+        }
+
+        XorList emptyList;
+        XorList nonEmptyList;
+
+    };
+
+    TEST_F(XorLinkedListFixtureClassTest, CopyMoveSwapAndCompare) {
+        XorList copiedList(nonEmptyList);
+        EXPECT_EQ(true, copiedList == nonEmptyList);
+        copiedList.back() = -1;
+        EXPECT_EQ(true, copiedList != nonEmptyList);
+
+        // The first and the last nodes refer to the sentinel, which changes its address
+        XorList movedList(std::move(copiedList));
+        EXPECT_EQ(true, copiedList.empty());
+        EXPECT_EQ(-1, movedList.back());
+        EXPECT_EQ(-1, *(--movedList.end()));
+
+        XorList singleList;
+        singleList.push_back(42);
+        swap(singleList, movedList);
+        EXPECT_EQ(42, *(--movedList.end()));
+        EXPECT_EQ(42, *movedList.begin());
+        EXPECT_EQ(10, singleList.size());
+        EXPECT_EQ(0, singleList.front());
+        swap(emptyList, movedList);
+        EXPECT_EQ(true, movedList.empty());
+        EXPECT_EQ(42, emptyList.back());
+
+        copiedList = singleList;
+        EXPECT_EQ(true, copiedList == singleList);
+        std::stringstream listOutputStream;
+        listOutputStream << copiedList;
+        EXPECT_EQ("[0 <---> 1 <---> 2 <---> 3 <---> 4 <---> 5 <---> 6 <---> 7 <---> 8 <---> -1]\n",
+                  listOutputStream.str());
+    }
+
+    TEST_F(XorLinkedListFixtureClassTest, Reverse) {
+        std::list<int> reference(nonEmptyList.begin(), nonEmptyList.end());
+        nonEmptyList.reverse();
+        reference.reverse();
+        EXPECT_EQ(true, isEqualToReference(nonEmptyList, reference));
+        EXPECT_EQ(9, nonEmptyList.front());
+        EXPECT_EQ(0, nonEmptyList.back());
+
+        // The links decoded in the new direction take the insertions and erasures at both ends and in the middle
+        nonEmptyList.push_front(10);
+        nonEmptyList.push_back(-1);
+        nonEmptyList.insert(nonEmptyList.begin() + 3, 100);
+        nonEmptyList.erase(nonEmptyList.begin() + 6);
+        nonEmptyList.pop_front();
+        reference.push_front(10);
+        reference.push_back(-1);
+        reference.insert(std::next(reference.begin(), 3), 100);
+        reference.erase(std::next(reference.begin(), 6));
+        reference.pop_front();
+        EXPECT_EQ(true, isEqualToReference(nonEmptyList, reference));
+
+        nonEmptyList.reverse();
+        reference.reverse();
+        EXPECT_EQ(true, isEqualToReference(nonEmptyList, reference));
+
+        emptyList.reverse();
+        EXPECT_EQ(true, emptyList.empty());
+        emptyList.push_back(1);
+        emptyList.reverse();
+        EXPECT_EQ(1, emptyList.front());
+        EXPECT_EQ(1, emptyList.back());
+    }
+
+    TEST_F(XorLinkedListFixtureClassTest, NodeIsOneWordSmaller) {
+        size_t xorNodeBytes = 0;
+        size_t nodeBytes = 0;
+        LinkedLists::XorLinkedList<long, SizeRecordingAllocator<long>> xorList(SizeRecordingAllocator<long>{&xorNodeBytes});
+        LinkedLists::DoubleLinkedList<long, SizeRecordingAllocator<long>> list(SizeRecordingAllocator<long>{&nodeBytes});
+        xorList.push_back(1);
+        list.push_back(1);
+        EXPECT_EQ(nodeBytes - sizeof(void *), xorNodeBytes);
+    }
+
+    TEST_F(XorLinkedListFixtureClassTest, MoveOnlyElements) {
+        LinkedLists::XorLinkedList<std::unique_ptr<std::string>> list;
+        for (int i = 0; i < 10; i++) {
+            list.emplace_front(new std::string(std::to_string(i)));
+        }
+        auto current = list.begin() + 3;
+        for (int i = 0; i < 5; i++) {
+            current = list.erase(current);
+        }
+        EXPECT_EQ(5, list.size());
+        EXPECT_EQ("9", *list.front());
+        EXPECT_EQ("1", **(list.begin() + 3));
+        EXPECT_EQ("0", *list.back());
+    }
+
+}